@@ -4,6 +4,7 @@
 
 #include "core/InstrumentFactory.hpp"
 #include "core/EngineFactory.hpp"
+#include "core/Portfolio.hpp"
 #include "market/MarketData.hpp"
 #include "models/BlackScholesModel.hpp"
 #include "models/BlackIRModel.hpp"
@@ -61,5 +62,21 @@ int main() {
     swaption.setPricingEngine(swaptionEngine);
     std::cout << "Swaption NPV      = " << swaption.NPV() << "\n";
 
+    // ===== Portefeuille : mêmes trades, valorisés en parallèle =====
+    core::Portfolio book;
+    book.add(std::make_shared<products::EuropeanOption>(std::move(call)));
+    book.add(std::make_shared<products::Caplet>(caplet));
+    book.add(std::make_shared<products::InterestRateSwap>(swap));
+    book.add(std::make_shared<products::Swaption>(swaption));
+    book.add(std::make_shared<products::AsianOption>(
+        core::InstrumentFactory::makeAsianOption(core::OptionType::Call, 100.0, 1.0)));
+    book.assignEngines(engineFactory);
+
+    auto res = book.price();
+    std::cout << "\nPortefeuille NPV  = " << res.total << "\n";
+    for (const auto& [model, npv] : res.byModel) {
+        std::cout << "  " << model << " : " << npv << "\n";
+    }
+
     return 0;
 }
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "core/Instrument.hpp"
+#include "core/Portfolio.hpp"
+#include "core/PricingResults.hpp"
+#include "utils/Cancellation.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace pricer::core {
+
+// Résultat d'un calcul lancé sur un pool. cancel() demande l'arrêt : une
+// tâche pas encore démarrée ne calcule rien, un Monte Carlo s'arrête au
+// bloc de chemins suivant, et get() lève alors utils::OperationCancelled.
+// Un calcul déjà terminé rend son résultat normalement.
+template <class T>
+class PricingFuture {
+public:
+    PricingFuture() = default;
+    PricingFuture(std::future<T> future, pricer::utils::CancellationToken token)
+        : future_(std::move(future)), token_(std::move(token)) {}
+
+    bool valid() const { return future_.valid(); }
+    bool ready() const {
+        return future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+    void wait() const { future_.wait(); }
+
+    // Bloquant ; rend le résultat ou relance l'exception du calcul
+    T get() { return future_.get(); }
+
+    void cancel() const { token_.cancel(); }
+    bool cancelRequested() const { return token_.cancelled(); }
+
+private:
+    std::future<T> future_;
+    pricer::utils::CancellationToken token_;
+};
+
+// Prix d'un instrument par son moteur, sans passer par le cache de
+// l'instrument : l'appelant peut continuer à s'en servir pendant le calcul.
+// Sans moteur : résultats nuls.
+PricingFuture<PricingResults>
+priceAsync(std::shared_ptr<const Instrument> inst,
+           pricer::utils::ThreadPool& pool = pricer::utils::defaultThreadPool());
+
+// Portefeuille entier (Portfolio::price) ; book doit rester en vie jusqu'à
+// la fin du calcul. Les setters de marché (setSpot, setRate, setSigma...)
+// peuvent être appelés pendant ce temps depuis un autre thread : un prix
+// calculé avant le tick n'entre pas dans le cache des instruments, et un
+// calcul annulé ou devenu périmé n'y laisse rien. Le calcul suivant repart
+// du nouveau marché.
+PricingFuture<PortfolioResults>
+priceAsync(const Portfolio& book,
+           pricer::utils::ThreadPool& pool = pricer::utils::defaultThreadPool(),
+           std::size_t chunkSize = 256);
+
+} 
@@ -1,27 +1,103 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
 
+#include "core/Instrument.hpp"
 #include "core/PricingEngine.hpp"
 #include "models/BlackScholesModel.hpp"
 #include "models/BlackIRModel.hpp"
 
 namespace pricer::core {
 
-class Instrument; 
-
+// Choix du moteur par type de produit : table indexée par le type exact de
+// l'instrument (typeid), remplie avant le premier createEngine puis figée
+// et lue sans verrou. Les moteurs sont partagés : un seul moteur de chaque
+// type par fabrique (donc par modèle), réutilisé pour tous les instruments
+// qui y sont routés.
 class EngineFactory {
 public:
+    // Crée (ou retrouve) le moteur d'un instrument, pour la fabrique donnée
+    using Creator = std::function<std::shared_ptr<PricingEngine>(const EngineFactory&,
+                                                                 const Instrument&)>;
+
     EngineFactory(std::shared_ptr<pricer::models::BlackScholesModel> equityModel,
-                  std::shared_ptr<pricer::models::BlackIRModel> irModel)
-        : equityModel_(std::move(equityModel)),
-          irModel_(std::move(irModel)) {}
+                  std::shared_ptr<pricer::models::BlackIRModel> irModel);
 
     std::shared_ptr<PricingEngine> createEngine(const Instrument& inst) const;
 
+    // Ajoute (ou remplace) la règle d'un type de produit ; lève une
+    // exception après le premier createEngine. Parent : classe de base
+    // enregistrée dont Product affine la règle (Instrument si aucune).
+    // Une classe dérivée non enregistrée prend la règle enregistrée dont
+    // la chaîne de parents contient toutes les autres règles qui
+    // l'acceptent ; sinon (bases sans lien déclaré) createEngine lève une
+    // exception.
+    template <class Product, class Parent = Instrument>
+    void registerEngine(Creator creator) {
+        static_assert(std::is_base_of_v<Parent, Product> && !std::is_same_v<Parent, Product>,
+                      "EngineFactory::registerEngine: Parent doit être une base de Product");
+        if (frozen_.load(std::memory_order_acquire)) {
+            throw std::runtime_error("EngineFactory::registerEngine: table figée après le premier createEngine");
+        }
+        registry_.insert_or_assign(std::type_index(typeid(Product)), Entry{
+            std::move(creator),
+            [](const Instrument& inst) { return dynamic_cast<const Product*>(&inst) != nullptr; },
+            std::type_index(typeid(Parent))});
+    }
+
+    // Moteur partagé de type E : construit au premier appel avec args,
+    // puis réutilisé (les arguments des appels suivants sont ignorés)
+    template <class E, class... Args>
+    std::shared_ptr<PricingEngine> shared(Args&&... args) const {
+        std::type_index type(typeid(E));
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            if (auto it = engines_.find(type); it != engines_.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto& slot = engines_[type];
+        if (!slot) {
+            slot = std::make_shared<E>(std::forward<Args>(args)...);
+        }
+        return slot;
+    }
+
+    const std::shared_ptr<pricer::models::BlackScholesModel>& equityModel() const { return equityModel_; }
+    const std::shared_ptr<pricer::models::BlackIRModel>& irModel() const { return irModel_; }
+
 private:
+    struct Entry {
+        Creator create;
+        bool (*matches)(const Instrument&);
+        std::type_index parent;
+    };
+
+    void registerDefaults();
+    const Entry& findEntry(const Instrument& inst) const;
+    const Entry& resolveDerived(const Instrument& inst) const;
+    bool refines(const Entry& entry, std::type_index base) const;
+
     std::shared_ptr<pricer::models::BlackScholesModel> equityModel_;
     std::shared_ptr<pricer::models::BlackIRModel>      irModel_;
+
+    std::unordered_map<std::type_index, Entry> registry_;
+    mutable std::atomic<bool> frozen_{false};
+
+    // Sous mutex_ : règle retenue pour les types dérivés, moteurs partagés
+    mutable std::shared_mutex mutex_;
+    mutable std::unordered_map<std::type_index, const Entry*> derived_;
+    mutable std::unordered_map<std::type_index, std::shared_ptr<PricingEngine>> engines_;
 };
 
 } 
@@ -1,24 +1,82 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <typeinfo>
+
+#include "core/Observable.hpp"
+#include "core/PricingResults.hpp"
 
 namespace pricer::core {
 
 class PricingEngine;
+class Portfolio;
 
-class Instrument {
+// Le prix est calculé à la demande puis gardé en cache jusqu'à un
+// changement du moteur, du modèle ou des courbes (update()). Le cache est
+// sous verrou et daté par une époque, incrémentée à chaque invalidation :
+// un prix calculé pendant un tick de marché (setSpot depuis un autre
+// thread) est rendu mais pas gardé. Le moteur ne change pas
+// (setPricingEngine) pendant un calcul du même instrument.
+class Instrument : public Observer {
 public:
-    virtual ~Instrument() = default;
+    // Accès au cache réservé aux calculs en paquets de Portfolio
+    class BatchAccess {
+        friend class Portfolio;
+        BatchAccess() {}
+    };
+
+    Instrument(const Instrument& other);
+    Instrument& operator=(const Instrument& other);
+    ~Instrument() override;
 
     void setPricingEngine(std::shared_ptr<PricingEngine> engine);
+    const std::shared_ptr<PricingEngine>& pricingEngine() const { return pricingEngine_; }
 
     double NPV() const;
 
+    // Prix et informations de calcul (erreur type, chemins, temps)
+    PricingResults results() const;
+
+    // Vide le cache : prochain NPV() / results() recalculé
+    void update() override;
+
+    // Cache des calculs en paquets : époque lue avant calculateBatch, prix
+    // en cache (vide s'il est invalide), prix gardé seulement si l'époque
+    // n'a pas changé depuis
+    std::uint64_t cacheEpoch(BatchAccess) const;
+    std::optional<double> cachedNPV(BatchAccess) const;
+    void storeNPV(double npv, std::uint64_t epoch, BatchAccess) const;
+
 protected:
     Instrument() = default;
 
 private:
+    void keepNPV(double npv, std::uint64_t epoch) const;
+
     std::shared_ptr<PricingEngine> pricingEngine_;
+
+    // Verrou feuille, jamais tenu pendant un calcul ; garde les trois
+    // membres suivants
+    mutable std::mutex mutex_;
+    std::uint64_t      epoch_ = 0;
+
+    // Résultats complets alloués à la demande : un instrument dont on ne
+    // lit que NPV() reste compact
+    mutable std::optional<double>                 npv_;
+    mutable std::shared_ptr<const PricingResults> results_;
 };
 
+// Instrument vu dans son type concret T : comparaison de typeid pour le
+// type exact, dynamic_cast pour une classe dérivée ; nullptr sinon
+template <class T>
+const T* instrumentAs(const Instrument& inst) {
+    if (typeid(inst) == typeid(T)) {
+        return static_cast<const T*>(&inst);
+    }
+    return dynamic_cast<const T*>(&inst);
+}
+
 } 
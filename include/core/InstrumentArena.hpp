@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "core/Payoff.hpp"
+
+namespace pricer::core {
+
+// Arène monotone pour le chargement d'un gros livre : instruments, payoffs
+// et échéanciers sont pris dans de grands blocs, sans malloc par objet, et
+// tout le livre est rendu d'un coup (release() ou destruction de l'arène).
+//
+// Les objets créés restent valides jusqu'à release() ; leurs destructeurs
+// sont alors appelés dans l'ordre inverse de création. Non thread-safe.
+class InstrumentArena {
+public:
+    // Taille du premier bloc ; les suivants grandissent géométriquement
+    explicit InstrumentArena(std::size_t initialBytes = 1 << 20);
+    ~InstrumentArena();
+
+    InstrumentArena(const InstrumentArena&) = delete;
+    InstrumentArena& operator=(const InstrumentArena&) = delete;
+
+    std::pmr::memory_resource* resource() { return &resource_; }
+
+    // T construit dans l'arène, détruit par release()
+    template <class T, class... Args>
+    T* create(Args&&... args) {
+        void* memory = resource_.allocate(sizeof(T), alignof(T));
+        T* object = ::new (memory) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            void* node = resource_.allocate(sizeof(Cleanup), alignof(Cleanup));
+            cleanups_ = ::new (node) Cleanup{[](void* p) { static_cast<T*>(p)->~T(); }, object, cleanups_};
+        }
+        ++objects_;
+        return object;
+    }
+
+    // Payoff dans l'arène : le produit qui le détient le détruit sans
+    // libérer la mémoire
+    template <class P, class... Args>
+    PayoffPtr makePayoff(Args&&... args) {
+        void* memory = resource_.allocate(sizeof(P), alignof(P));
+        return PayoffPtr(::new (memory) P(std::forward<Args>(args)...), PayoffDeleter(false));
+    }
+
+    // shared_ptr non propriétaire (aucun bloc de contrôle alloué), pour
+    // Portfolio : l'arène doit survivre au portefeuille
+    template <class T>
+    static std::shared_ptr<T> share(T* object) {
+        return std::shared_ptr<T>(std::shared_ptr<T>(), object);
+    }
+
+    std::size_t objectCount() const { return objects_; }
+
+    // Détruit tous les objets et rend la mémoire
+    void release();
+
+private:
+    struct Cleanup {
+        void (*destroy)(void*);
+        void* object;
+        Cleanup* next;
+    };
+
+    std::pmr::monotonic_buffer_resource resource_;
+    Cleanup* cleanups_ = nullptr;
+    std::size_t objects_ = 0;
+};
+
+} 
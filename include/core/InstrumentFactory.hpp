@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/InstrumentArena.hpp"
 #include "core/Payoff.hpp"
 #include "products/EuropeanOption.hpp"
 #include "products/DigitalOption.hpp"
@@ -31,7 +32,8 @@ public:
 
     // Option barrière up-and-out (simple)
     static pricer::products::BarrierOption
-    makeUpAndOutOption(OptionType type, double K, double T, double barrier);
+    makeUpAndOutOption(OptionType type, double K, double T, double barrier,
+                       double rebate = 0.0);
 
     // ==== Taux ====
 
@@ -53,6 +55,42 @@ public:
     static pricer::products::Swaption
     makeSwaption(const pricer::products::InterestRateSwap& underlying,
                  double exerciseTime);
+
+    // ==== Mode arène ====
+    // Mêmes produits construits dans arena, payoff et échéancier compris :
+    // aucune allocation individuelle. Pointeurs valides jusqu'à
+    // arena.release().
+
+    static pricer::products::EuropeanOption*
+    makeEuropeanOption(InstrumentArena& arena, OptionType type, double K, double T);
+
+    static pricer::products::DigitalOption*
+    makeDigitalOption(InstrumentArena& arena, OptionType type, double K, double T, double payout);
+
+    static pricer::products::AsianOption*
+    makeAsianOption(InstrumentArena& arena, OptionType type, double K, double T);
+
+    static pricer::products::BarrierOption*
+    makeUpAndOutOption(InstrumentArena& arena, OptionType type, double K, double T,
+                       double barrier, double rebate = 0.0);
+
+    static pricer::products::Caplet*
+    makeCaplet(InstrumentArena& arena, double notional, double strike, double forward,
+               double start, double end, double yearFraction);
+
+    static pricer::products::InterestRateSwap*
+    makeSwap(InstrumentArena& arena,
+             double notional,
+             double fixedRate,
+             const std::vector<double>& paymentTimes,
+             const std::vector<double>& accruals,
+             double forwardRate,
+             bool payer);
+
+    static pricer::products::Swaption*
+    makeSwaption(InstrumentArena& arena,
+                 const pricer::products::InterestRateSwap& underlying,
+                 double exerciseTime);
 };
 
 } 
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace pricer::core {
+
+class Observer;
+
+// Objet dont les changements sont signalés aux observateurs enregistrés
+// (données de marché, modèles, moteurs). La copie ne reprend pas les
+// observateurs.
+//
+// Threads : notification, inscription et désinscription peuvent venir de
+// threads différents (tick de marché pendant un Portfolio::price, moteur
+// changé ou instrument détruit ailleurs). Le verrou de l'observable est
+// tenu pendant toute la notification : un observateur qui se désinscrit
+// attend la fin de la notification en cours et n'est plus appelé ensuite.
+// Les notifications descendent le graphe (courbe -> modèle -> moteur ->
+// instrument) ; un update() peut s'inscrire ou se désinscrire auprès de
+// l'observable qui le notifie (verrou récursif).
+class Observable {
+public:
+    Observable() = default;
+    Observable(const Observable&) {}
+    Observable& operator=(const Observable&) { return *this; }
+    virtual ~Observable() = default;
+
+    // Appelle update() sur chaque observateur encore inscrit, sous verrou
+    void notifyObservers();
+
+private:
+    friend class Observer;
+
+    void registerObserver(Observer* observer);
+    void unregisterObserver(Observer* observer);
+
+    // Ensemble : un moteur partagé peut suivre tout un portefeuille
+    std::recursive_mutex mutex_;
+    std::unordered_set<Observer*> observers_;
+};
+
+// Dépendant d'un ou plusieurs Observable : les garde en vie (shared_ptr)
+// et se désinscrit à la destruction. Une copie s'enregistre auprès des
+// mêmes observables. Une classe qui redéfinit update() appelle
+// unregisterAll() en tête de son destructeur : ~Observer vient trop tard,
+// update() pourrait être appelé sur des membres déjà détruits.
+class Observer {
+public:
+    Observer() = default;
+    Observer(const Observer& other);
+    Observer& operator=(const Observer& other);
+    virtual ~Observer();
+
+    // Sans effet pour un pointeur nul ou un observable déjà suivi
+    void registerWith(const std::shared_ptr<Observable>& observable);
+    void unregisterWith(const std::shared_ptr<Observable>& observable);
+
+    virtual void update() = 0;
+
+protected:
+    // Désinscription de tous les observables ; attend les notifications en
+    // cours
+    void unregisterAll();
+
+private:
+    std::vector<std::shared_ptr<Observable>> observables_;
+};
+
+} 
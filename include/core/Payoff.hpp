@@ -1,21 +1,69 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+
 namespace pricer::core {
 
 enum class OptionType { Call, Put };
 
+// Payoff standard dont dérive un payoff, pour retrouver son noyau inliné
+// (core/PayoffKernels.hpp) sans dynamic_cast
+enum class PayoffKind { Generic, PlainVanilla, Digital };
+
 class Payoff {
 public:
+    Payoff() = default;
     virtual ~Payoff() = default;
     virtual double operator()(double spot) const = 0;
+
+    // out[i] = payoff(spots[i]) : un seul appel virtuel par bloc, boucle
+    // inlinée (et vectorisable) dans les payoffs standards
+    virtual void evaluate(const double* spots, double* out, std::size_t n) const;
+
+    // Non virtuel : fixé par les seuls constructeurs des payoffs standards,
+    // un payoff client reste Generic (ou hérite du type de sa base)
+    PayoffKind kind() const { return kind_; }
+
+private:
+    friend class PlainVanillaPayoff;
+    friend class DigitalPayoff;
+    explicit Payoff(PayoffKind kind) : kind_(kind) {}
+
+    PayoffKind kind_ = PayoffKind::Generic;
 };
 
+// Payoff détenu par un produit. Par défaut propriétaire (delete) ; un
+// payoff créé dans une InstrumentArena est seulement détruit, sa mémoire
+// étant rendue avec l'arène. Un std::unique_ptr<P> s'y convertit.
+struct PayoffDeleter {
+    bool owned = true;
+
+    PayoffDeleter() = default;
+    explicit PayoffDeleter(bool isOwned) : owned(isOwned) {}
+    template <class P>
+    PayoffDeleter(const std::default_delete<P>&) {}
+
+    void operator()(Payoff* payoff) const {
+        if (owned) {
+            delete payoff;
+        } else {
+            payoff->~Payoff();
+        }
+    }
+};
+
+using PayoffPtr = std::unique_ptr<Payoff, PayoffDeleter>;
+
 class PlainVanillaPayoff : public Payoff {
 public:
+    static constexpr PayoffKind staticKind = PayoffKind::PlainVanilla;
+
     PlainVanillaPayoff(OptionType type, double strike)
-        : type_(type), strike_(strike) {}
+        : Payoff(staticKind), type_(type), strike_(strike) {}
 
     double operator()(double spot) const override;
+    void evaluate(const double* spots, double* out, std::size_t n) const override;
 
     OptionType type() const { return type_; }
     double strike() const { return strike_; }
@@ -27,10 +75,13 @@ private:
 
 class DigitalPayoff : public Payoff {
 public:
+    static constexpr PayoffKind staticKind = PayoffKind::Digital;
+
     DigitalPayoff(OptionType type, double strike, double payout)
-        : type_(type), strike_(strike), payout_(payout) {}
+        : Payoff(staticKind), type_(type), strike_(strike), payout_(payout) {}
 
     double operator()(double spot) const override;
+    void evaluate(const double* spots, double* out, std::size_t n) const override;
 
     OptionType type() const { return type_; }
     double strike() const { return strike_; }
@@ -42,5 +93,11 @@ private:
     double payout_;
 };
 
+// Équivalent de dynamic_cast<const P*> pour les payoffs standards, classes
+// dérivées comprises
+template <class P>
+const P* payoffAs(const Payoff& payoff) {
+    return payoff.kind() == P::staticKind ? static_cast<const P*>(&payoff) : nullptr;
+}
 
 } 
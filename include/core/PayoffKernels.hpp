@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <typeinfo>
+#include <utility>
+
+#include "core/Payoff.hpp"
+
+namespace pricer::core {
+
+// Noyaux de payoff à type d'option fixé à la compilation : appel non
+// virtuel, inlinable dans les boucles sur les chemins
+
+template <OptionType Type>
+struct VanillaKernel {
+    double strike;
+
+    double operator()(double spot) const {
+        if constexpr (Type == OptionType::Call) {
+            return std::max(spot - strike, 0.0);
+        } else {
+            return std::max(strike - spot, 0.0);
+        }
+    }
+};
+
+template <OptionType Type>
+struct DigitalKernel {
+    double strike;
+    double payout;
+
+    double operator()(double spot) const {
+        if constexpr (Type == OptionType::Call) {
+            return spot > strike ? payout : 0.0;
+        } else {
+            return spot < strike ? payout : 0.0;
+        }
+    }
+};
+
+// Payoff hors catalogue : appel virtuel à chaque spot
+struct GenericKernel {
+    const Payoff* payoff;
+
+    double operator()(double spot) const { return (*payoff)(spot); }
+};
+
+template <class Kernel>
+void applyPayoff(const Kernel& kernel, const double* spots, double* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = kernel(spots[i]);
+    }
+}
+
+// Appelle f(kernel) avec le noyau concret du payoff : f est instancié une
+// fois par type de payoff et par type d'option. Une seule résolution par
+// appel, à faire en dehors des boucles sur les chemins.
+template <class F>
+decltype(auto) visitPayoff(const Payoff& payoff, F&& f) {
+    constexpr OptionType call = OptionType::Call;
+    constexpr OptionType put  = OptionType::Put;
+
+    // Noyau compilé pour le type exact seulement : une classe dérivée d'un
+    // payoff standard peut redéfinir operator() et passe par le générique.
+    // Le type fixé, dynamic_cast ne coûte qu'une fois par appel.
+    switch (payoff.kind()) {
+    case PayoffKind::PlainVanilla:
+        if (typeid(payoff) == typeid(PlainVanillaPayoff)) {
+            auto const& pv = dynamic_cast<const PlainVanillaPayoff&>(payoff);
+            if (pv.type() == call) return std::forward<F>(f)(VanillaKernel<call>{pv.strike()});
+            return std::forward<F>(f)(VanillaKernel<put>{pv.strike()});
+        }
+        break;
+    case PayoffKind::Digital:
+        if (typeid(payoff) == typeid(DigitalPayoff)) {
+            auto const& dp = dynamic_cast<const DigitalPayoff&>(payoff);
+            if (dp.type() == call) return std::forward<F>(f)(DigitalKernel<call>{dp.strike(), dp.payout()});
+            return std::forward<F>(f)(DigitalKernel<put>{dp.strike(), dp.payout()});
+        }
+        break;
+    default:
+        break;
+    }
+    return std::forward<F>(f)(GenericKernel{&payoff});
+}
+
+} 
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/Instrument.hpp"
+#include "core/PricingEngine.hpp"
+
+namespace pricer::utils {
+class ThreadPool;
+}
+
+namespace pricer::core {
+
+class EngineFactory;
+
+struct PortfolioResults {
+    std::vector<double> npvs;  // dans l'ordre d'ajout
+    double total = 0.0;
+
+    // Sommes par type de produit (EuropeanOption, Caplet...) et par
+    // modèle (BlackScholes, BlackIR)
+    std::map<std::string, double> byProduct;
+    std::map<std::string, double> byModel;
+
+    double elapsedSeconds = 0.0;
+};
+
+// Livre d'instruments actions et taux, valorisé en parallèle sur un pool
+// de threads.
+//
+// Ordonnancement : les calculs coûteux (estimatedCost > 1, Monte Carlo)
+// partent en premier, du plus long au plus court, une tâche chacun (une
+// seule pour les trades d'un moteur à calcul partagé) ; les formules
+// fermées suivent par paquets de chunkSize instruments, triés par moteur
+// pour passer par calculateBatch. Le cache NPV des instruments est lu
+// (prix valide : pas de calcul) et rempli par les paquets, sauf pour un
+// instrument invalidé entre-temps : un tick de marché pendant price()
+// n'y laisse pas de prix périmé. Un instrument ne doit figurer qu'une fois
+// dans le livre.
+class Portfolio {
+public:
+    // L'instrument garde son moteur (sans moteur : NPV nul)
+    void add(std::shared_ptr<Instrument> inst);
+    void add(std::shared_ptr<Instrument> inst, std::shared_ptr<PricingEngine> engine);
+
+    // Moteur de la fabrique pour chaque instrument qui n'en a pas
+    void assignEngines(const EngineFactory& factory);
+
+    std::size_t size() const { return trades_.size(); }
+    const Instrument& instrument(std::size_t i) const { return *trades_[i].instrument; }
+    const std::shared_ptr<Instrument>& sharedInstrument(std::size_t i) const { return trades_[i].instrument; }
+    const char* productType(std::size_t i) const { return trades_[i].product; }
+    const char* modelName(std::size_t i) const { return trades_[i].model; }
+
+    // Depuis une tâche du même pool, l'attente exécute les tâches en file.
+    // Dans un calcul annulable (priceAsync), chaque tâche teste l'annulation
+    // avant de démarrer et les Monte Carlo entre deux blocs de chemins.
+    PortfolioResults price(pricer::utils::ThreadPool& pool, std::size_t chunkSize = 256) const;
+
+    // Sur defaultThreadPool()
+    PortfolioResults price() const;
+
+private:
+    struct Trade {
+        std::shared_ptr<Instrument> instrument;
+        const char* product;
+        const char* model;
+    };
+
+    std::vector<Trade> trades_;
+};
+
+} 
@@ -1,21 +1,85 @@
 #pragma once
 
+#include <memory>
+
+#include "core/Observable.hpp"
+#include "core/PricingResults.hpp"
+#include "utils/Span.hpp"
+
+namespace pricer::models {
+class BlackScholesModel;
+class BlackIRModel;
+}
+
 namespace pricer::core {
 
 class Instrument; 
 
-class PricingEngine {
+// Un moteur observe son modèle (registerWith dans le constructeur) et
+// relaie ses changements aux instruments qui l'utilisent
+class PricingEngine : public Observable, public Observer {
 public:
-    virtual ~PricingEngine() = default;
+    ~PricingEngine() override { unregisterAll(); }
+
+    void update() override { notifyObservers(); }
 
     double calculate(const Instrument& inst) const {
         return priceImpl(inst);
     }
 
+    PricingResults calculateResults(const Instrument& inst) const {
+        return resultsImpl(inst);
+    }
+
+    // Prix d'une série d'instruments du type traité par le moteur :
+    // out[i] = calculate(*instruments[i]). Lève une exception si les
+    // tailles diffèrent.
+    void calculateBatch(pricer::utils::Span<const Instrument* const> instruments,
+                        pricer::utils::Span<double> out) const;
+
+    // Coût relatif d'un calcul, pour l'ordonnancement d'un portefeuille
+    // (1 = formule fermée, nombre de tirages pour le Monte Carlo)
+    double estimatedCost(const Instrument& inst) const {
+        return costImpl(inst);
+    }
+
+    // Vrai si un seul calcul valorise tous les instruments du moteur
+    // (chemins partagés) : estimatedCost est alors celui de ce calcul et un
+    // portefeuille réunit ces instruments dans une même tâche
+    bool sharesCalculation() const {
+        return sharedImpl();
+    }
+
+    // Même moteur (méthode, réglages, graine) sur d'autres modèles, pour
+    // revaloriser sur un marché choqué ; chaque moteur prend le modèle de
+    // son type. nullptr si le moteur ne sait pas se reconstruire.
+    std::shared_ptr<PricingEngine> clone(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+                                         std::shared_ptr<pricer::models::BlackIRModel> rates) const {
+        return cloneImpl(std::move(equity), std::move(rates));
+    }
+
 protected:
     PricingEngine() = default;
 
     virtual double priceImpl(const Instrument& inst) const = 0;
+
+    // Par défaut : le prix seul. Les moteurs Monte Carlo surchargent pour
+    // fournir erreur type, chemins simulés et temps de calcul.
+    virtual PricingResults resultsImpl(const Instrument& inst) const;
+
+    // Par défaut : priceImpl instrument par instrument. Les moteurs en
+    // formule fermée surchargent avec une boucle qui lit le modèle une
+    // seule fois et passe par les formules en lot.
+    virtual void batchImpl(pricer::utils::Span<const Instrument* const> instruments,
+                           pricer::utils::Span<double> out) const;
+
+    virtual double costImpl(const Instrument&) const { return 1.0; }
+
+    virtual bool sharedImpl() const { return false; }
+
+    virtual std::shared_ptr<PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel>,
+              std::shared_ptr<pricer::models::BlackIRModel>) const { return nullptr; }
 };
 
 } 
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+namespace pricer::core {
+
+// Sensibilités du prix. Actions : delta et gamma au spot. Taux : au taux
+// forward (ou de swap). Vega, rho et dividendRho pour une variation de 1
+// (et non 1%) ; theta par an de temps calendaire écoulé.
+struct Greeks {
+    double delta = 0.0;
+    double gamma = 0.0;
+    double vega  = 0.0;
+    double rho   = 0.0;          // taux d'actualisation
+    double theta = 0.0;
+    double dividendRho = 0.0;    // taux de dividende continu (actions)
+    double annuity = 0.0;        // dV/dA (taux) : A = annuité du swap, ou fraction d'année * DF(fin)
+};
+
+// Résultat détaillé d'un calcul de prix
+struct PricingResults {
+    double npv = 0.0;
+
+    // Monte Carlo : erreur type de l'estimateur (0 pour une formule fermée,
+    // NaN si la méthode ne fournit pas d'estimation d'erreur)
+    double stdError = 0.0;
+
+    // Monte Carlo : nombre de chemins effectivement simulés
+    std::size_t paths = 0;
+
+    // Temps de calcul (secondes)
+    double elapsedSeconds = 0.0;
+
+    // Grecques, si le moteur les calcule (absentes sinon)
+    std::optional<Greeks> greeks;
+};
+
+} 
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "core/PricingResults.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "utils/BlackFormula.hpp"
+
+namespace pricer::engines {
+
+// Grecques Black-Scholes d'un prix V = DF(T) * b(F(T), sigma sqrt(T)),
+// F(T) = S exp((r - q) T), à partir des dérivées de b. T > 0.
+pricer::core::Greeks blackScholesGreeks(const pricer::utils::BlackSensitivities& b,
+                                        const pricer::models::BlackScholesModel& model,
+                                        double T);
+
+// Grecques Black d'un produit de taux V = notional * A * b(F, sigma sqrt(Texp)) :
+// A = annuité (ou fraction d'année * DF(fin)), dAdr = dA/dr pour un
+// déplacement parallèle de la courbe, r = taux de la courbe. Texp > 0.
+pricer::core::Greeks blackRatesGreeks(const pricer::utils::BlackSensitivities& b,
+                                      double notional, double A, double dAdr,
+                                      double r, double sigma, double Texp);
+
+} 
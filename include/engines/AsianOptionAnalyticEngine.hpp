@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include "core/PricingEngine.hpp"
+#include "models/BlackScholesModel.hpp"
+
+namespace pricer::engines {
+
+enum class AsianApproximation {
+    TurnbullWakeman,
+    Levy,
+    Curran
+};
+
+// Asiatique à payoff vanille sous Black–Scholes en formule fermée.
+// Moyenne géométrique : formule exacte. Moyenne arithmétique :
+// approximation au choix (Curran par défaut, la plus précise hors de la
+// monnaie). Sans calendrier, la moyenne porte sur defaultFixings dates
+// équidistantes dans ]0, T], comme la grille du moteur Monte Carlo.
+class AsianOptionAnalyticEngine : public pricer::core::PricingEngine {
+public:
+    explicit AsianOptionAnalyticEngine(
+        std::shared_ptr<pricer::models::BlackScholesModel> model,
+        AsianApproximation method = AsianApproximation::Curran,
+        std::size_t defaultFixings = 50)
+        : model_(std::move(model)),
+          method_(method),
+          defaultFixings_(defaultFixings)
+    {
+        registerWith(model_);
+    }
+
+protected:
+    double priceImpl(const pricer::core::Instrument& inst) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+              std::shared_ptr<pricer::models::BlackIRModel>) const override {
+        return std::make_shared<AsianOptionAnalyticEngine>(std::move(equity), method_, defaultFixings_);
+    }
+
+private:
+    std::shared_ptr<pricer::models::BlackScholesModel> model_;
+    AsianApproximation method_;
+    std::size_t defaultFixings_;
+};
+
+} 
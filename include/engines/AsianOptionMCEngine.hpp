@@ -3,28 +3,49 @@
 #include <memory>
 #include "core/PricingEngine.hpp"
 #include "models/BlackScholesModel.hpp"
+#include "engines/MonteCarloSettings.hpp"
 
 namespace pricer::engines {
 
+// Asiatique en Monte Carlo sous Black–Scholes. Sans calendrier, la moyenne
+// porte sur nSteps dates équidistantes ; avec un calendrier, les chemins
+// sont simulés exactement aux dates de fixing futures (nSteps ignoré).
 class AsianOptionMCEngine : public pricer::core::PricingEngine {
 public:
     AsianOptionMCEngine(std::shared_ptr<pricer::models::BlackScholesModel> model,
                         std::size_t nPaths,
                         std::size_t nSteps,
-                        unsigned long seed = 42UL)
+                        unsigned long seed = 42UL,
+                        MonteCarloSettings settings = {})
         : model_(std::move(model)),
           nPaths_(nPaths),
           nSteps_(nSteps),
-          seed_(seed) {}
+          seed_(seed),
+          settings_(settings)
+    {
+        registerWith(model_);
+    }
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
+    pricer::core::PricingResults resultsImpl(const pricer::core::Instrument& inst) const override;
+
+    double costImpl(const pricer::core::Instrument&) const override {
+        return static_cast<double>(nPaths_) * static_cast<double>(nSteps_);
+    }
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+              std::shared_ptr<pricer::models::BlackIRModel>) const override {
+        return std::make_shared<AsianOptionMCEngine>(std::move(equity), nPaths_, nSteps_, seed_, settings_);
+    }
 
 private:
     std::shared_ptr<pricer::models::BlackScholesModel> model_;
     std::size_t nPaths_;
     std::size_t nSteps_;
     unsigned long seed_;
+    MonteCarloSettings settings_;
 };
 
 } 
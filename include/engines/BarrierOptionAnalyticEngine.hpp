@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include "core/PricingEngine.hpp"
+#include "models/BlackScholesModel.hpp"
+
+namespace pricer::engines {
+
+// Barrière à surveillance continue en formule fermée (Reiner–Rubinstein,
+// notations de Haug) : quatre BarrierType, call et put vanille, rebate.
+class BarrierOptionAnalyticEngine : public pricer::core::PricingEngine {
+public:
+    explicit BarrierOptionAnalyticEngine(
+        std::shared_ptr<pricer::models::BlackScholesModel> model)
+        : model_(std::move(model)) { registerWith(model_); }
+
+protected:
+    double priceImpl(const pricer::core::Instrument& inst) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+              std::shared_ptr<pricer::models::BlackIRModel>) const override {
+        return std::make_shared<BarrierOptionAnalyticEngine>(std::move(equity));
+    }
+
+private:
+    std::shared_ptr<pricer::models::BlackScholesModel> model_;
+};
+
+} 
@@ -3,6 +3,7 @@
 #include <memory>
 #include "core/PricingEngine.hpp"
 #include "models/BlackScholesModel.hpp"
+#include "engines/MonteCarloSettings.hpp"
 
 namespace pricer::engines {
 
@@ -11,20 +12,37 @@ public:
     BarrierOptionMCEngine(std::shared_ptr<pricer::models::BlackScholesModel> model,
                           std::size_t nPaths,
                           std::size_t nSteps,
-                          unsigned long seed = 123UL)
+                          unsigned long seed = 123UL,
+                          MonteCarloSettings settings = {})
         : model_(std::move(model)),
           nPaths_(nPaths),
           nSteps_(nSteps),
-          seed_(seed) {}
+          seed_(seed),
+          settings_(settings)
+    {
+        registerWith(model_);
+    }
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
+    pricer::core::PricingResults resultsImpl(const pricer::core::Instrument& inst) const override;
+
+    double costImpl(const pricer::core::Instrument&) const override {
+        return static_cast<double>(nPaths_) * static_cast<double>(nSteps_);
+    }
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+              std::shared_ptr<pricer::models::BlackIRModel>) const override {
+        return std::make_shared<BarrierOptionMCEngine>(std::move(equity), nPaths_, nSteps_, seed_, settings_);
+    }
 
 private:
     std::shared_ptr<pricer::models::BlackScholesModel> model_;
     std::size_t nPaths_;
     std::size_t nSteps_;
     unsigned long seed_;
+    MonteCarloSettings settings_;
 };
 
 } 
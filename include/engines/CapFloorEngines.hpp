@@ -4,16 +4,38 @@
 #include "core/PricingEngine.hpp"
 #include "models/BlackIRModel.hpp"
 
+namespace pricer::products {
+class Caplet;
+}
+
 namespace pricer::engines {
 
 class CapletBlackEngine : public pricer::core::PricingEngine {
 public:
     explicit CapletBlackEngine(std::shared_ptr<pricer::models::BlackIRModel> model)
-        : model_(std::move(model)) {}
+        : model_(std::move(model)) { registerWith(model_); }
+
+    // Volatilité de Black du caplet qui redonne price avec les conventions
+    // du moteur (notionnel * fraction d'année * DF(fin), écart-type sur start)
+    double impliedVolatility(const pricer::products::Caplet& caplet, double price) const;
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
 
+    // Prix et grecques Black sur une seule évaluation de d1/d2 : delta et
+    // gamma au forward, vega, theta, rho (courbe), dV/d(fraction d'année * DF(fin)).
+    // Avant l'exercice seulement (sinon le prix seul).
+    pricer::core::PricingResults resultsImpl(const pricer::core::Instrument& inst) const override;
+
+    void batchImpl(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                   pricer::utils::Span<double> out) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel>,
+              std::shared_ptr<pricer::models::BlackIRModel> rates) const override {
+        return std::make_shared<CapletBlackEngine>(std::move(rates));
+    }
+
 private:
     std::shared_ptr<pricer::models::BlackIRModel> model_;
 };
@@ -21,10 +43,18 @@ private:
 class CapBlackEngine : public pricer::core::PricingEngine {
 public:
     explicit CapBlackEngine(std::shared_ptr<pricer::models::BlackIRModel> model)
-        : model_(std::move(model)) {}
+        : model_(std::move(model)) { registerWith(model_); }
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
+    void batchImpl(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                   pricer::utils::Span<double> out) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel>,
+              std::shared_ptr<pricer::models::BlackIRModel> rates) const override {
+        return std::make_shared<CapBlackEngine>(std::move(rates));
+    }
 
 private:
     std::shared_ptr<pricer::models::BlackIRModel> model_;
@@ -33,10 +63,18 @@ private:
 class FloorBlackEngine : public pricer::core::PricingEngine {
 public:
     explicit FloorBlackEngine(std::shared_ptr<pricer::models::BlackIRModel> model)
-        : model_(std::move(model)) {}
+        : model_(std::move(model)) { registerWith(model_); }
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
+    void batchImpl(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                   pricer::utils::Span<double> out) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel>,
+              std::shared_ptr<pricer::models::BlackIRModel> rates) const override {
+        return std::make_shared<FloorBlackEngine>(std::move(rates));
+    }
 
 private:
     std::shared_ptr<pricer::models::BlackIRModel> model_;
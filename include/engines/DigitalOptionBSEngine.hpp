@@ -10,11 +10,24 @@ class DigitalOptionBSEngine : public pricer::core::PricingEngine {
 public:
     explicit DigitalOptionBSEngine(
         std::shared_ptr<pricer::models::BlackScholesModel> model)
-        : model_(std::move(model)) {}
+        : model_(std::move(model)) { registerWith(model_); }
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
 
+    // Prix et grecques (delta, gamma, vega, theta, rho, dividendRho) en
+    // formule fermée, sur une seule évaluation de d1/d2
+    pricer::core::PricingResults resultsImpl(const pricer::core::Instrument& inst) const override;
+
+    void batchImpl(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                   pricer::utils::Span<double> out) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+              std::shared_ptr<pricer::models::BlackIRModel>) const override {
+        return std::make_shared<DigitalOptionBSEngine>(std::move(equity));
+    }
+
 private:
     std::shared_ptr<pricer::models::BlackScholesModel> model_;
 };
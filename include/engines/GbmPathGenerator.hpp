@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace pricer::engines {
+
+// Noyau vectorisé de simulation GBM sur un bloc de chemins.
+//
+// Les chemins d'un bloc avancent pas à pas en parallèle et sont stockés en
+// structure de tableaux : z[i * n + p] est l'aléa du pas i du chemin p.
+// L'exponentielle passe par utils::vexp (AVX2/AVX-512 choisi à
+// l'exécution, repli scalaire sinon).
+class GbmPathGenerator {
+public:
+    // Nombre de chemins avancés ensemble (les aléas d'un bloc tiennent en L2)
+    static constexpr std::size_t lockstepPaths = 64;
+
+    GbmPathGenerator(double S0, double drift, double volDt, std::size_t nSteps);
+
+    // Grille non uniforme : dérive et volatilité propres à chaque pas
+    GbmPathGenerator(double S0, std::vector<double> drift, std::vector<double> volDt);
+
+    std::size_t nSteps() const { return nSteps_; }
+
+    // Simule n chemins à partir des aléas z (nSteps x n).
+    // onStep(i, S) est appelé après chaque pas avec les n spots courants.
+    template <class StepFn>
+    void simulate(const double* z, std::size_t n, StepFn&& onStep) {
+        spot_.assign(n, S0_);
+        work_.resize(n);
+        for (std::size_t i = 0; i < nSteps_; ++i) {
+            advance(i, z + i * n, n);
+            onStep(i, static_cast<const double*>(spot_.data()));
+        }
+    }
+
+    // Spots des n chemins après le dernier pas simulé
+    const double* spots() const { return spot_.data(); }
+
+private:
+    void advance(std::size_t i, const double* z, std::size_t n);
+
+    double S0_;
+    std::vector<double> drift_;
+    std::vector<double> volDt_;
+    std::size_t nSteps_;
+    std::vector<double> spot_;
+    std::vector<double> work_;
+};
+
+} 
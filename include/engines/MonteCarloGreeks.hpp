@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "core/Payoff.hpp"
+#include "core/PricingResults.hpp"
+#include "engines/MonteCarloRunner.hpp"
+
+namespace pricer::engines {
+
+// Estimateurs d'un produit quand les grecques sont demandées :
+// prix, delta, gamma, vega, rho (dans cet ordre)
+constexpr std::size_t greekEstimators = 5;
+
+// Échantillons de grecques d'un paquet de chemins, non actualisés
+struct GreekSamples {
+    std::vector<double> delta, gamma, vega, rho;
+
+    void resize(std::size_t n) {
+        delta.resize(n);
+        gamma.resize(n);
+        vega.resize(n);
+        rho.resize(n);
+    }
+};
+
+// Ajoute les échantillons d'un paquet aux estimateurs stats[0..4) :
+// delta, gamma, vega, rho
+void addGreekSamples(PathStatistics* stats, const GreekSamples& samples,
+                     std::size_t n, bool antithetic);
+
+// Sommes par chemin nécessaires aux grecques sous Black-Scholes, mises à
+// jour pas à pas sur un paquet SoA de n chemins.
+class PathGreekState {
+public:
+    PathGreekState(double S0, double sigma, double dt)
+        : S0_(S0), sigma_(sigma), dt_(dt), sqrtDt_(std::sqrt(dt)) {}
+
+    // Grille non uniforme : dates des pas, strictement croissantes
+    PathGreekState(double S0, double sigma, std::vector<double> times);
+
+    void reset(std::size_t n);
+
+    // Pas i (à partir de 0) : incréments normés zi, spots S en fin de pas
+    void step(std::size_t i, const double* zi, const double* S);
+
+    // Pathwise pour un payoff vanille sur une moyenne de m fixings
+    // (m = 1 et spot final : européenne). avg : moyenne par chemin, dont
+    // fixedPart provient de fixings déjà constatés (insensibles à S0).
+    void pathwise(const pricer::core::PlainVanillaPayoff& payoff,
+                  const double* avg, std::size_t m, GreekSamples& out,
+                  double fixedPart = 0.0) const;
+
+    // Rapport de vraisemblance : payoff X pondéré par les scores de la
+    // densité du chemin (payoffs discontinus)
+    void likelihoodRatio(const double* X, GreekSamples& out) const;
+
+    const double* z1() const { return z1_.data(); }
+
+private:
+    double S0_, sigma_, dt_, sqrtDt_;  // dt_ : premier pas
+    std::vector<double> times_;        // vide : grille uniforme de pas dt_
+    std::vector<double> sqrtDts_;
+    std::size_t n_ = 0;
+    std::size_t steps_ = 0;
+    std::vector<double> z1_;     // premier incrément normé
+    std::vector<double> W_;      // mouvement brownien W_i
+    std::vector<double> sumZ2_;  // somme des z^2
+    std::vector<double> sumSW_;  // somme des dS_i/dsigma = S_i (W_i - sigma t_i)
+    std::vector<double> sumTS_;  // somme des dS_i/dr = t_i S_i
+};
+
+// Grecques actualisées à partir des estimateurs [offset, offset + 5) ;
+// le rho ajoute la dérivée du facteur d'actualisation (-T * prix)
+pricer::core::Greeks collectGreeks(const std::vector<MonteCarloEstimate>& est,
+                                   std::size_t offset, double T);
+
+} 
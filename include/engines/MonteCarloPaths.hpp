@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "engines/MonteCarloSettings.hpp"
+#include "utils/BrownianBridge.hpp"
+#include "utils/Philox.hpp"
+#include "utils/Normal.hpp"
+#include "utils/Sobol.hpp"
+
+namespace pricer::engines {
+
+// Bloc de chemins [first, last) d'une réplication
+struct PathBlock {
+    std::size_t replication;
+    std::size_t first;
+    std::size_t last;
+};
+
+// Aléas gaussiens des chemins d'un moteur Monte Carlo.
+//
+// Découpe les nPaths chemins en blocs (et en réplications pour Sobol
+// brouillé) de façon indépendante du nombre de threads, et fournit pour
+// chaque bloc un flux reproductible de nSteps aléas N(0,1) par chemin.
+class PathNormals {
+public:
+    PathNormals(const MonteCarloSettings& settings,
+                std::size_t nPaths,
+                std::size_t nSteps,
+                unsigned long seed);
+
+    const std::vector<PathBlock>& blocks() const { return blocks_; }
+    std::size_t replications() const { return nReplications_; }
+
+    // Flux d'aléas d'un bloc ; une instance par thread
+    class Stream {
+    public:
+        // Aléas des n chemins suivants, en structure de tableaux :
+        // z[i * n + p] = incrément normalisé du pas i du chemin p.
+        // En mode antithétique, le chemin p + (n+1)/2 utilise -z du chemin p.
+        void fill(double* z, std::size_t n);
+
+    private:
+        friend class PathNormals;
+        Stream() = default;
+
+        // Remplit les colonnes [0, m) d'un tableau de n chemins
+        void generate(double* z, std::size_t n, std::size_t m);
+
+        std::size_t nSteps_ = 0;
+        bool antithetic_ = false;
+        std::mt19937_64 gen_;
+        pricer::utils::ZigguratNormal norm_;
+        std::unique_ptr<pricer::utils::SobolSequence> sobol_;
+        std::unique_ptr<pricer::utils::Philox4x32> philox_;
+        std::uint64_t nextPath_ = 0;  // Philox : indice du prochain tirage
+        const pricer::utils::BrownianBridge* bridge_ = nullptr;
+        std::vector<double> uniforms_;
+        std::vector<double> gaussians_;
+        std::vector<double> increments_;
+    };
+
+    Stream stream(std::size_t block) const;
+
+private:
+    MonteCarloSettings settings_;
+    std::size_t nPaths_;
+    std::size_t nSteps_;
+    unsigned long seed_;
+    std::size_t nReplications_;
+    std::vector<PathBlock> blocks_;
+    std::vector<pricer::utils::SobolSequence> sobol_;  // une suite par réplication
+    std::unique_ptr<pricer::utils::BrownianBridge> bridge_;
+};
+
+} 
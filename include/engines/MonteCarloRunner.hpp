@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "engines/MonteCarloPaths.hpp"
+#include "engines/MonteCarloSettings.hpp"
+#include "engines/MonteCarloStatistics.hpp"
+
+namespace pricer::engines {
+
+// Estimation Monte Carlo agrégée
+struct MonteCarloEstimate {
+    double mean = 0.0;
+    double stdError = 0.0;   // NaN si non estimable (Sobol non brouillé)
+    std::size_t paths = 0;
+};
+
+// Boucle commune des moteurs Monte Carlo.
+//
+// simulateBlock(b, stats) simule le bloc b de normals et accumule ses
+// échantillons. Les blocs sont traités par lots en parallèle ; entre deux
+// lots, les critères d'arrêt des settings sont testés. La moyenne (corrigée
+// par la variable de contrôle si controlExpectation est fourni) et l'erreur
+// type sont multipliées par scale (typiquement le facteur d'actualisation).
+// Un calcul annulé (utils::currentCancellation) s'arrête au bloc suivant
+// en levant utils::OperationCancelled.
+MonteCarloEstimate runMonteCarlo(
+    const PathNormals& normals,
+    const MonteCarloSettings& settings,
+    std::optional<double> controlExpectation,
+    double scale,
+    const std::function<void(std::size_t, PathStatistics&)>& simulateBlock);
+
+// Variante à plusieurs estimateurs sur les mêmes chemins : simulateBlock(b,
+// stats) remplit stats[0..n). Les estimateurs sont groupés par stride
+// (prix puis grecques d'un même produit) : l'arrêt sur erreur cible attend
+// que le premier estimateur de chaque groupe l'atteigne.
+std::vector<MonteCarloEstimate> runMonteCarlo(
+    const PathNormals& normals,
+    const MonteCarloSettings& settings,
+    const std::vector<std::optional<double>>& controlExpectations,
+    const std::vector<double>& scales,
+    const std::function<void(std::size_t, PathStatistics*)>& simulateBlock,
+    std::size_t stride = 1);
+
+} 
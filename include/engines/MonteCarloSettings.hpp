@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+
+namespace pricer::engines {
+
+// Source des aléas des chemins
+enum class RandomGenerator {
+    MersenneTwister,  // pseudo-aléatoire, un sous-flux mt19937_64 par bloc
+    Sobol,            // quasi-aléatoire, construction par pont brownien
+    Philox            // pseudo-aléatoire à compteur : l'aléa du pas i du
+                      // chemin p ne dépend que de (seed, p, i)
+};
+
+// Surveillance de la barrière (BarrierOptionMCEngine)
+enum class BarrierMonitoring {
+    Discrete,   // barrière observée aux seules dates de simulation
+    Continuous  // surveillance continue : probabilité de franchissement
+                // entre deux dates calculée par pont brownien
+};
+
+// Paramètres d'exécution communs aux moteurs Monte Carlo
+struct MonteCarloSettings {
+    // Nombre de threads de calcul (1 = séquentiel, 0 = nombre de coeurs).
+    // Les blocs sont des tâches du pool courant : dans un Portfolio, les
+    // threads inactifs prennent des blocs des gros Monte Carlo.
+    std::size_t nThreads = 1;
+
+    // Taille des blocs de chemins. Chaque bloc a son propre flux aléatoire
+    // dérivé de la seed : le prix ne dépend donc pas du nombre de threads.
+    std::size_t blockSize = 1024;
+
+    RandomGenerator generator = RandomGenerator::MersenneTwister;
+
+    // Sobol uniquement : nombre de réplications brouillées indépendantes
+    // entre lesquelles les nPaths chemins sont répartis (0 = Sobol brut).
+    std::size_t scrambledReplications = 0;
+
+    // Variables antithétiques : chaque chemin est apparié au chemin
+    // construit sur les aléas opposés (-z)
+    bool antithetic = false;
+
+    // Asiatique uniquement : variable de contrôle sur la moyenne géométrique
+    // (prix fermé), coefficient de régression estimé sur la simulation
+    bool controlVariate = false;
+
+    // Barrière uniquement : en mode continu, le biais de discrétisation
+    // disparaît et quelques pas de temps suffisent
+    BarrierMonitoring barrierMonitoring = BarrierMonitoring::Discrete;
+
+    // Arrêt adaptatif : nPaths devient un maximum. La simulation avance par
+    // lots et s'arrête dès que l'erreur type (en unités de prix) passe sous
+    // targetStdError ou que timeBudget (secondes) est écoulé. 0 = désactivé.
+    // Avec un critère d'erreur seul, le résultat reste reproductible.
+    double targetStdError = 0.0;
+    double timeBudget = 0.0;
+
+    // Grecques (delta, gamma, vega, rho) estimées sur les chemins du prix :
+    // pathwise pour les payoffs continus, rapport de vraisemblance sinon
+    bool computeGreeks = false;
+
+    // Chemins simulés entre deux tests d'arrêt (arrondi aux blocs, et aux
+    // réplications pour Sobol brouillé)
+    std::size_t batchPaths = 16384;
+};
+
+} 
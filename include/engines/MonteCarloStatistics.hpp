@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace pricer::engines {
+
+// Sommes d'un estimateur Monte Carlo : échantillons y et, optionnellement,
+// variable de contrôle x associée. Les blocs sont fusionnés dans un ordre
+// fixe pour garder un résultat reproductible.
+struct PathStatistics {
+    std::size_t count = 0;
+    double sumY  = 0.0;
+    double sumY2 = 0.0;
+    double sumX  = 0.0;
+    double sumX2 = 0.0;
+    double sumXY = 0.0;
+
+    void add(double y) {
+        ++count;
+        sumY  += y;
+        sumY2 += y * y;
+    }
+
+    void add(double y, double x) {
+        add(y);
+        sumX  += x;
+        sumX2 += x * x;
+        sumXY += x * y;
+    }
+
+    void merge(const PathStatistics& other) {
+        count += other.count;
+        sumY  += other.sumY;
+        sumY2 += other.sumY2;
+        sumX  += other.sumX;
+        sumX2 += other.sumX2;
+        sumXY += other.sumXY;
+    }
+
+    double meanY() const { return sumY / static_cast<double>(count); }
+    double meanX() const { return sumX / static_cast<double>(count); }
+
+    // Coefficient de régression de y sur x (variable de contrôle)
+    double beta() const {
+        double n   = static_cast<double>(count);
+        double cov = sumXY - sumX * sumY / n;
+        double var = sumX2 - sumX * sumX / n;
+        return (var > 0.0) ? cov / var : 0.0;
+    }
+
+    // Moyenne de y corrigée par la variable de contrôle d'espérance ex
+    double controlledMean(double ex) const {
+        return meanY() - beta() * (meanX() - ex);
+    }
+
+    // Variance empirique d'un échantillon y
+    double variance() const {
+        double n = static_cast<double>(count);
+        if (count < 2) return 0.0;
+        return std::max(sumY2 - sumY * sumY / n, 0.0) / (n - 1.0);
+    }
+
+    // Variance résiduelle de y - beta * x
+    double controlledVariance() const {
+        double n = static_cast<double>(count);
+        if (count < 2) return 0.0;
+        double syy = sumY2 - sumY * sumY / n;
+        double sxx = sumX2 - sumX * sumX / n;
+        double sxy = sumXY - sumX * sumY / n;
+        double res = (sxx > 0.0) ? syy - sxy * sxy / sxx : syy;
+        return std::max(res, 0.0) / (n - 1.0);
+    }
+};
+
+// Ajoute les n valeurs d'un paquet de chemins. Avec appariement
+// antithétique, les chemins p et p + (n+1)/2 forment un seul échantillon.
+// x peut être nul (pas de variable de contrôle).
+void addPathSamples(PathStatistics& stats,
+                    const double* y, const double* x,
+                    std::size_t n, bool antithetic);
+
+} 
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "core/PricingEngine.hpp"
+#include "core/Payoff.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "engines/MonteCarloSettings.hpp"
+
+namespace pricer::engines {
+
+// Moteur Monte Carlo à chemins partagés : les produits equity enregistrés
+// (européen, digital, asiatique, barrière) sur un même modèle sont évalués
+// en une seule simulation sur la grille [0, horizon] à nSteps pas.
+// Chaque maturité doit tomber sur un point de la grille ; l'asiatique
+// moyenne arithmétiquement les pas jusqu'à sa maturité (pas de calendrier
+// de fixings explicite).
+//
+// Les instruments enregistrés doivent rester en vie tant que le moteur
+// sert à les évaluer. Le premier NPV() lance la simulation, les suivants
+// lisent le cache ; add(), reset() ou un changement du modèle l'invalident.
+class SharedPathMCEngine : public pricer::core::PricingEngine {
+public:
+    SharedPathMCEngine(std::shared_ptr<pricer::models::BlackScholesModel> model,
+                       double horizon,
+                       std::size_t nSteps,
+                       std::size_t nPaths,
+                       unsigned long seed = 42UL,
+                       MonteCarloSettings settings = {});
+    ~SharedPathMCEngine() override { unregisterAll(); }
+
+    void add(const pricer::core::Instrument& inst);
+
+    std::size_t size() const;
+
+    void reset();
+
+    void update() override;
+
+protected:
+    double priceImpl(const pricer::core::Instrument& inst) const override;
+    pricer::core::PricingResults resultsImpl(const pricer::core::Instrument& inst) const override;
+
+    // La simulation du livre entier, déclenchée par le premier appel
+    double costImpl(const pricer::core::Instrument&) const override {
+        return static_cast<double>(nPaths_) * static_cast<double>(nSteps_);
+    }
+
+    bool sharedImpl() const override { return true; }
+
+    // Mêmes réglages et mêmes trades enregistrés, simulation à refaire
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+              std::shared_ptr<pricer::models::BlackIRModel>) const override;
+
+private:
+    enum class TradeKind { Terminal, Asian, Barrier };
+
+    struct Trade {
+        TradeKind kind;
+        const pricer::core::Payoff* payoff;
+        std::size_t step;               // indice de maturité sur la grille
+        std::size_t group = 0;          // barrière : groupe de surveillance
+        bool out = false;
+        double rebate = 0.0;            // knock-out : au contact, knock-in : à maturité
+        const pricer::core::PlainVanillaPayoff* cvPayoff = nullptr;
+    };
+
+    // Barrières de même niveau, sens et maturité : un seul suivi par chemin
+    struct BarrierGroup {
+        double barrier;
+        bool up;
+        std::size_t step;
+        bool hitDiscount = false;       // un knock-out à rebate : D(date de contact) suivi
+    };
+
+    std::size_t gridStep(double maturity) const;
+    void simulate() const;
+
+    std::shared_ptr<pricer::models::BlackScholesModel> model_;
+    double horizon_;
+    std::size_t nSteps_;
+    std::size_t nPaths_;
+    unsigned long seed_;
+    MonteCarloSettings settings_;
+
+    std::vector<Trade> trades_;
+    std::vector<BarrierGroup> groups_;
+    std::unordered_map<const pricer::core::Instrument*, std::size_t> index_;
+
+    mutable std::mutex mutex_;
+    mutable bool calculated_ = false;
+    mutable std::vector<pricer::core::PricingResults> results_;
+};
+
+} 
@@ -4,15 +4,27 @@
 #include "core/PricingEngine.hpp"
 #include "models/BlackIRModel.hpp"
 
+namespace pricer::products {
+class Swaption;
+}
+
 namespace pricer::engines {
 
 class SwapEngine : public pricer::core::PricingEngine {
 public:
     explicit SwapEngine(std::shared_ptr<pricer::models::BlackIRModel> model)
-        : model_(std::move(model)) {}
+        : model_(std::move(model)) { registerWith(model_); }
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
+    void batchImpl(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                   pricer::utils::Span<double> out) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel>,
+              std::shared_ptr<pricer::models::BlackIRModel> rates) const override {
+        return std::make_shared<SwapEngine>(std::move(rates));
+    }
 
 private:
     std::shared_ptr<pricer::models::BlackIRModel> model_;
@@ -21,11 +33,29 @@ private:
 class SwaptionBlackEngine : public pricer::core::PricingEngine {
 public:
     explicit SwaptionBlackEngine(std::shared_ptr<pricer::models::BlackIRModel> model)
-        : model_(std::move(model)) {}
+        : model_(std::move(model)) { registerWith(model_); }
+
+    // Volatilité de Black de la swaption qui redonne price avec les
+    // conventions du moteur (notionnel * annuité, écart-type sur l'exercice)
+    double impliedVolatility(const pricer::products::Swaption& swaption, double price) const;
 
 protected:
     double priceImpl(const pricer::core::Instrument& inst) const override;
 
+    // Prix et grecques Black sur une seule évaluation de d1/d2 : delta et
+    // gamma au taux de swap, vega, theta, rho (courbe), dV/d(annuité).
+    // Avant l'exercice seulement (sinon le prix seul).
+    pricer::core::PricingResults resultsImpl(const pricer::core::Instrument& inst) const override;
+
+    void batchImpl(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                   pricer::utils::Span<double> out) const override;
+
+    std::shared_ptr<pricer::core::PricingEngine>
+    cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel>,
+              std::shared_ptr<pricer::models::BlackIRModel> rates) const override {
+        return std::make_shared<SwaptionBlackEngine>(std::move(rates));
+    }
+
 private:
     std::shared_ptr<pricer::models::BlackIRModel> model_;
 };
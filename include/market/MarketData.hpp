@@ -1,31 +1,48 @@
 #pragma once
 
+#include <atomic>
+
+#include "core/Observable.hpp"
+#include "utils/Span.hpp"
+
 namespace pricer::market {
 
-class YieldCurve {
+// Les setters préviennent les dépendants (modèles, puis moteurs et
+// instruments) pour invalider les prix en cache. Valeurs atomiques : un
+// tick peut arriver d'un autre thread pendant un calcul.
+class YieldCurve : public pricer::core::Observable {
 public:
     explicit YieldCurve(double flatRate)
         : r_(flatRate) {}
 
-    double rate() const { return r_; }
+    double rate() const { return r_.load(std::memory_order_relaxed); }
 
     double discount(double T) const; 
 
+    // out[i] = discount(times[i]), en une passe vectorielle ; lève une
+    // exception si les tailles diffèrent
+    void discount(pricer::utils::Span<const double> times, pricer::utils::Span<double> out) const;
+
+    void setRate(double flatRate);
+
 private:
-    double r_;
+    std::atomic<double> r_;
 };
 
-class EquityCurve {
+class EquityCurve : public pricer::core::Observable {
 public:
     EquityCurve(double spot, double dividendYield)
         : spot_(spot), q_(dividendYield) {}
 
-    double spot() const { return spot_; }
-    double dividendYield() const { return q_; }
+    double spot() const { return spot_.load(std::memory_order_relaxed); }
+    double dividendYield() const { return q_.load(std::memory_order_relaxed); }
+
+    void setSpot(double spot);
+    void setDividendYield(double dividendYield);
 
 private:
-    double spot_;
-    double q_;
+    std::atomic<double> spot_;
+    std::atomic<double> q_;
 };
 
 } 
@@ -1,30 +1,51 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include "core/Observable.hpp"
 #include "market/MarketData.hpp"
+#include "utils/Span.hpp"
 
 namespace pricer::models {
 
-class BlackIRModel {
+// Observe sa courbe et relaie ses changements aux moteurs
+class BlackIRModel : public pricer::core::Observable,
+                     public pricer::core::Observer {
 public:
     explicit BlackIRModel(std::shared_ptr<pricer::market::YieldCurve> discountCurve,
                           double sigma)
         : discountCurve_(std::move(discountCurve)),
-          sigma_(sigma) {}
+          sigma_(sigma)
+    {
+        registerWith(discountCurve_);
+    }
 
     double discount(double T) const {
         return discountCurve_->discount(T);
     }
 
+    void discount(pricer::utils::Span<const double> times, pricer::utils::Span<double> out) const {
+        discountCurve_->discount(times, out);
+    }
+
     double rate() const {
         return discountCurve_->rate();
     }
 
-    double sigma() const { return sigma_; }
+    double sigma() const { return sigma_.load(std::memory_order_relaxed); }
+
+    void setSigma(double sigma) {
+        sigma_.store(sigma, std::memory_order_relaxed);
+        notifyObservers();
+    }
+
+    ~BlackIRModel() override { unregisterAll(); }
+
+    void update() override { notifyObservers(); }
 
 private:
     std::shared_ptr<pricer::market::YieldCurve> discountCurve_;
-    double sigma_;
+    std::atomic<double> sigma_;
 };
 
 } 
@@ -1,31 +1,53 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include "core/Observable.hpp"
 #include "market/MarketData.hpp"
+#include "utils/Span.hpp"
 
 namespace pricer::models {
 
-class BlackScholesModel {
+// Observe ses courbes et relaie leurs changements à ses propres
+// observateurs (moteurs)
+class BlackScholesModel : public pricer::core::Observable,
+                          public pricer::core::Observer {
 public:
     BlackScholesModel(std::shared_ptr<pricer::market::YieldCurve> discountCurve,
                       std::shared_ptr<pricer::market::EquityCurve> equityCurve,
                       double sigma)
         : discountCurve_(std::move(discountCurve)),
           equityCurve_(std::move(equityCurve)),
-          sigma_(sigma) {}
+          sigma_(sigma)
+    {
+        registerWith(discountCurve_);
+        registerWith(equityCurve_);
+    }
 
     double spot() const;
-    double sigma() const { return sigma_; }
+    double sigma() const { return sigma_.load(std::memory_order_relaxed); }
     double discount(double T) const;
     double forward(double T) const;
+
+    // Versions en lot : out[i] = discount(times[i]) / forward(times[i]).
+    // Une courbe par appel au lieu d'une par date ; lèvent une exception si
+    // les tailles diffèrent.
+    void discount(pricer::utils::Span<const double> times, pricer::utils::Span<double> out) const;
+    void forward(pricer::utils::Span<const double> times, pricer::utils::Span<double> out) const;
     double rate() const;
     double dividendYield() const;
 
+    void setSigma(double sigma);
+
+    ~BlackScholesModel() override { unregisterAll(); }
+
+    void update() override { notifyObservers(); }
+
 
 private:
     std::shared_ptr<pricer::market::YieldCurve> discountCurve_;
     std::shared_ptr<pricer::market::EquityCurve> equityCurve_;
-    double sigma_;
+    std::atomic<double> sigma_;
 };
 
 } 
\ No newline at end of file
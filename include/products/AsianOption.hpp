@@ -1,24 +1,50 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "core/Instrument.hpp"
 #include "core/Payoff.hpp"
 
 namespace pricer::products {
 
+enum class AverageType {
+    Arithmetic,
+    Geometric
+};
+
+// Option sur moyenne des fixings.
+//
+// Sans calendrier explicite, la moyenne porte sur la grille uniforme du
+// moteur (nSteps dates sur ]0, T]). Avec un calendrier, elle porte sur les
+// fixings déjà constatés (pastFixings, trade en cours de vie) et sur les
+// dates futures fixingTimes (strictement croissantes, dans ]0, T]).
 class AsianOption : public pricer::core::Instrument {
 public:
-    AsianOption(std::unique_ptr<pricer::core::Payoff> payoff,
+    AsianOption(pricer::core::PayoffPtr payoff,
                 double maturity)
         : payoff_(std::move(payoff)),
           maturity_(maturity) {}
 
+    AsianOption(pricer::core::PayoffPtr payoff,
+                double maturity,
+                std::vector<double> fixingTimes,
+                AverageType averageType = AverageType::Arithmetic,
+                std::vector<double> pastFixings = {});
+
     double maturity() const { return maturity_; }
     const pricer::core::Payoff& payoff() const { return *payoff_; }
 
+    AverageType averageType() const { return averageType_; }
+    bool hasSchedule() const { return !fixingTimes_.empty() || !pastFixings_.empty(); }
+    const std::vector<double>& fixingTimes() const { return fixingTimes_; }
+    const std::vector<double>& pastFixings() const { return pastFixings_; }
+
 private:
-    std::unique_ptr<pricer::core::Payoff> payoff_;
+    pricer::core::PayoffPtr payoff_;
     double maturity_;
+    AverageType averageType_ = AverageType::Arithmetic;
+    std::vector<double> fixingTimes_;
+    std::vector<double> pastFixings_;
 };
 
 } 
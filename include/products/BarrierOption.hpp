@@ -13,27 +13,34 @@ enum class BarrierType {
     DownAndIn
 };
 
+// Rebate : montant versé si l'option est désactivée. Knock-out : payé à
+// l'instant où la barrière est touchée ; knock-in : payé à maturité si la
+// barrière n'a jamais été touchée.
 class BarrierOption : public pricer::core::Instrument {
 public:
-    BarrierOption(std::unique_ptr<pricer::core::Payoff> payoff,
+    BarrierOption(pricer::core::PayoffPtr payoff,
                   double maturity,
                   double barrier,
-                  BarrierType type)
+                  BarrierType type,
+                  double rebate = 0.0)
         : payoff_(std::move(payoff)),
           maturity_(maturity),
           barrier_(barrier),
-          type_(type) {}
+          type_(type),
+          rebate_(rebate) {}
 
     double maturity() const { return maturity_; }
     double barrier() const { return barrier_; }
     BarrierType barrierType() const { return type_; }
+    double rebate() const { return rebate_; }
     const pricer::core::Payoff& payoff() const { return *payoff_; }
 
 private:
-    std::unique_ptr<pricer::core::Payoff> payoff_;
+    pricer::core::PayoffPtr payoff_;
     double maturity_;
     double barrier_;
     BarrierType type_;
+    double rebate_;
 };
 
 } 
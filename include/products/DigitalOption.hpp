@@ -8,7 +8,7 @@ namespace pricer::products {
 
 class DigitalOption : public pricer::core::Instrument {
 public:
-    DigitalOption(std::unique_ptr<pricer::core::Payoff> payoff,
+    DigitalOption(pricer::core::PayoffPtr payoff,
                   double maturity)
         : payoff_(std::move(payoff)),
           maturity_(maturity) {}
@@ -17,7 +17,7 @@ public:
     const pricer::core::Payoff& payoff() const { return *payoff_; }
 
 private:
-    std::unique_ptr<pricer::core::Payoff> payoff_;
+    pricer::core::PayoffPtr payoff_;
     double maturity_;
 };
 
@@ -1,40 +1,82 @@
 #pragma once
 
+#include <memory_resource>
 #include <vector>
 #include "core/Instrument.hpp"
+#include "utils/Span.hpp"
 
 namespace pricer::products {
 
 class InterestRateSwap : public pricer::core::Instrument {
 public:
+    // Échéancier sur la ressource par défaut
     InterestRateSwap(double notional,
                      double fixedRate,
-                     std::vector<double> paymentTimes,
-                     std::vector<double> accruals,
+                     const std::vector<double>& paymentTimes,
+                     const std::vector<double>& accruals,
                      double forwardRate,
                      bool payer)
+        : InterestRateSwap(notional, fixedRate,
+                           pricer::utils::Span<const double>(paymentTimes),
+                           pricer::utils::Span<const double>(accruals),
+                           forwardRate, payer, nullptr) {}
+
+    // Échéancier copié directement dans resource (arène d'une
+    // InstrumentArena par exemple) ; nullptr = ressource par défaut
+    InterestRateSwap(double notional,
+                     double fixedRate,
+                     pricer::utils::Span<const double> paymentTimes,
+                     pricer::utils::Span<const double> accruals,
+                     double forwardRate,
+                     bool payer,
+                     std::pmr::memory_resource* resource)
         : notional_(notional),
           fixedRate_(fixedRate),
-          paymentTimes_(std::move(paymentTimes)),
-          accruals_(std::move(accruals)),
+          paymentTimes_(paymentTimes.begin(), paymentTimes.end(), orDefault(resource)),
+          accruals_(accruals.begin(), accruals.end(), orDefault(resource)),
           forwardRate_(forwardRate),
           payer_(payer) {}
 
+    // Copie dont l'échéancier est alloué dans resource (une copie simple
+    // repasse par la ressource par défaut)
+    InterestRateSwap(const InterestRateSwap& other, std::pmr::memory_resource* resource)
+        : pricer::core::Instrument(other),
+          notional_(other.notional_),
+          fixedRate_(other.fixedRate_),
+          paymentTimes_(other.paymentTimes_, orDefault(resource)),
+          accruals_(other.accruals_, orDefault(resource)),
+          forwardRate_(other.forwardRate_),
+          payer_(other.payer_) {}
+
+    InterestRateSwap(const InterestRateSwap&) = default;
+    InterestRateSwap(InterestRateSwap&&) = default;
+    InterestRateSwap& operator=(const InterestRateSwap&) = default;
+    InterestRateSwap& operator=(InterestRateSwap&&) = default;
+
     double notional() const { return notional_; }
     double fixedRate() const { return fixedRate_; }
-    const std::vector<double>& paymentTimes() const { return paymentTimes_; }
-    const std::vector<double>& accruals() const { return accruals_; }
+    const std::pmr::vector<double>& paymentTimes() const { return paymentTimes_; }
+    const std::pmr::vector<double>& accruals() const { return accruals_; }
     double forwardRate() const { return forwardRate_; }
 
+    // Ressource de l'échéancier
+    std::pmr::memory_resource* scheduleResource() const {
+        return paymentTimes_.get_allocator().resource();
+    }
+
     // true  = payer swap (pay fixed, receive float)
     // false = receiver swap (receive fixed, pay float)
     bool payer() const { return payer_; }
 
 private:
+    static std::pmr::memory_resource* orDefault(std::pmr::memory_resource* resource) {
+        return resource ? resource : std::pmr::get_default_resource();
+    }
+
     double notional_;
     double fixedRate_;
-    std::vector<double> paymentTimes_;
-    std::vector<double> accruals_;
+    std::pmr::vector<double> paymentTimes_;
+    std::pmr::vector<double> accruals_;
     double forwardRate_;
     bool payer_;
 };
@@ -45,6 +87,12 @@ public:
         : underlying_(std::move(underlying)),
           exerciseTime_(exerciseTime) {}
 
+    // Sous-jacent copié dans resource
+    Swaption(const InterestRateSwap& underlying, double exerciseTime,
+             std::pmr::memory_resource* resource)
+        : underlying_(underlying, resource),
+          exerciseTime_(exerciseTime) {}
+
     const InterestRateSwap& underlying() const { return underlying_; }
     double exerciseTime() const { return exerciseTime_; }
 
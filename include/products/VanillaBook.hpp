@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/Instrument.hpp"
+#include "core/Payoff.hpp"
+#include "utils/Span.hpp"
+
+namespace pricer::products {
+
+enum class VanillaKind : std::uint8_t {
+    European,  // call / put
+    Digital    // cash-or-nothing, montant payout
+};
+
+// Livre d'options européennes et digitales rangé par colonnes : un tableau
+// contigu par champ (strike, maturité, type, montant, sous-jacent), ~33
+// octets par trade sans allocation ni indirection. À valoriser par
+// engines::VanillaBookEngine ; conversion vers et depuis les objets
+// EuropeanOption / DigitalOption.
+class VanillaBook {
+public:
+    void reserve(std::size_t n);
+    void clear();
+
+    void addEuropean(pricer::core::OptionType type, double strike, double maturity,
+                     std::uint32_t underlying = 0);
+    void addDigital(pricer::core::OptionType type, double strike, double maturity,
+                    double payout, std::uint32_t underlying = 0);
+
+    // EuropeanOption à payoff vanille ou DigitalOption à payoff digital ;
+    // lève une exception pour tout autre instrument
+    void add(const pricer::core::Instrument& inst, std::uint32_t underlying = 0);
+
+    // Instrument accepté par add()
+    static bool supports(const pricer::core::Instrument& inst);
+
+    // underlyings[i] = sous-jacent de instruments[i] ; vide : tous sur 0.
+    // Lève une exception si les tailles diffèrent.
+    static VanillaBook fromInstruments(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                                       pricer::utils::Span<const std::uint32_t> underlyings = {});
+
+    // Trade i sous forme d'objet (sans moteur). Un instrument ne porte pas
+    // de sous-jacent : celui du trade i reste underlyings()[i], à repasser
+    // à fromInstruments pour l'aller-retour.
+    std::unique_ptr<pricer::core::Instrument> instrument(std::size_t i) const;
+    std::vector<std::unique_ptr<pricer::core::Instrument>> toInstruments() const;
+
+    std::size_t size() const { return strike_.size(); }
+    bool empty() const { return strike_.empty(); }
+
+    // Colonnes
+    const std::vector<VanillaKind>& kinds() const { return kind_; }
+    const std::vector<pricer::core::OptionType>& types() const { return type_; }
+    const std::vector<double>& strikes() const { return strike_; }
+    const std::vector<double>& maturities() const { return maturity_; }
+    const std::vector<double>& payouts() const { return payout_; }   // 0 pour une européenne
+    const std::vector<std::uint32_t>& underlyings() const { return underlying_; }
+
+private:
+    void push(VanillaKind kind, pricer::core::OptionType type, double strike,
+              double maturity, double payout, std::uint32_t underlying);
+
+    std::vector<VanillaKind> kind_;
+    std::vector<pricer::core::OptionType> type_;
+    std::vector<double> strike_;
+    std::vector<double> maturity_;
+    std::vector<double> payout_;
+    std::vector<std::uint32_t> underlying_;
+};
+
+} 
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "utils/Span.hpp"
+
+namespace pricer::risk {
+
+// Choc d'un sous-jacent action : spot relatif (S -> S (1 + spot)),
+// volatilité et taux de dividende absolus
+struct EquityShift {
+    double spot     = 0.0;
+    double vol      = 0.0;
+    double dividend = 0.0;
+};
+
+// Choc de taux absolu, parallèle sur toutes les courbes, et choc absolu
+// de la volatilité du modèle de taux
+struct RateShift {
+    double rate = 0.0;
+    double vol  = 0.0;
+};
+
+// Scénarios de marché (historiques ou simulés) rangés par colonnes : un
+// RateShift et un EquityShift par sous-jacent pour chaque scénario
+class ScenarioSet {
+public:
+    explicit ScenarioSet(std::size_t nUnderlyings = 1);
+
+    void reserve(std::size_t nScenarios);
+
+    // equities[u] = choc du sous-jacent u ; lève une exception si la
+    // taille diffère de underlyingCount() ou si un choc de spot est <= -1
+    void add(const RateShift& rates, pricer::utils::Span<const EquityShift> equities);
+
+    // Un seul sous-jacent
+    void add(const RateShift& rates, const EquityShift& equity);
+
+    std::size_t size() const { return rates_.size(); }
+    bool empty() const { return rates_.empty(); }
+    std::size_t underlyingCount() const { return nUnderlyings_; }
+
+    const RateShift& rates(std::size_t s) const { return rates_[s]; }
+    const EquityShift& equity(std::size_t s, std::size_t u) const {
+        return equities_[s * nUnderlyings_ + u];
+    }
+
+private:
+    std::size_t nUnderlyings_;
+    std::vector<RateShift> rates_;
+    std::vector<EquityShift> equities_;  // scénario s : [s * n, (s + 1) * n)
+};
+
+} 
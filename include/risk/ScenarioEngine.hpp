@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/Instrument.hpp"
+#include "models/BlackIRModel.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "products/VanillaBook.hpp"
+#include "risk/Scenario.hpp"
+#include "utils/Span.hpp"
+
+namespace pricer::core {
+class Portfolio;
+}
+
+namespace pricer::risk {
+
+struct ScenarioResults {
+    double baseValue = 0.0;      // livre au marché de base
+    std::vector<double> values;  // valeur du livre par scénario
+    std::vector<double> pnl;     // values[s] - baseValue
+    double elapsedSeconds = 0.0;
+};
+
+// Revalorisation d'un livre sur un ensemble de scénarios (VaR historique
+// ou Monte Carlo), sans reconstruire courbes et modèles trade par trade.
+//
+// Européennes et digitales vanille sont rangées dans un VanillaBook : par
+// trade, ln K, sqrt(T) et le signe sont calculés une fois ; par scénario,
+// ln S, r, r - q et sigma choqués une fois par sous-jacent. La matrice
+// scénarios x trades est parcourue par tuiles (256 trades tenant en L1 x
+// un bloc de scénarios) réparties sur les threads.
+//
+// Les autres instruments gardent leur méthode : leur moteur est recopié
+// (PricingEngine::clone) sur les modèles choqués, une fois par scénario.
+// Un instrument sans moteur prend celui d'une EngineFactory sur le marché
+// choqué ; add() rejette un moteur qui ne sait pas se recopier. Base et
+// scénarios passent par les mêmes calculs : un choc nul donne un P&L nul.
+class ScenarioEngine {
+public:
+    // Sous-jacent action i = equities[i] ; rates valorise les produits de taux
+    ScenarioEngine(std::vector<std::shared_ptr<pricer::models::BlackScholesModel>> equities,
+                   std::shared_ptr<pricer::models::BlackIRModel> rates);
+
+    // Un seul sous-jacent action
+    ScenarioEngine(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+                   std::shared_ptr<pricer::models::BlackIRModel> rates);
+
+    // Lèvent une exception si un indice de sous-jacent est inconnu ou si le
+    // moteur d'un instrument hors VanillaBook ne se recopie pas
+    void add(const pricer::products::VanillaBook& book);
+    void add(std::shared_ptr<const pricer::core::Instrument> inst, std::uint32_t underlying = 0);
+    void add(const pricer::core::Portfolio& portfolio, std::uint32_t underlying = 0);
+
+    std::size_t size() const { return book_.size() + others_.size(); }
+
+    // Marché de base lu au moment de l'appel. nThreads comme
+    // MonteCarloSettings (0 = tous les coeurs). Annulable entre deux tuiles
+    // sous une CancellationScope.
+    ScenarioResults run(const ScenarioSet& scenarios, std::size_t nThreads = 0) const;
+
+private:
+    struct Trade {
+        std::shared_ptr<const pricer::core::Instrument> instrument;
+        std::uint32_t underlying;
+    };
+
+    std::vector<std::shared_ptr<pricer::models::BlackScholesModel>> equities_;
+    std::shared_ptr<pricer::models::BlackIRModel> rates_;
+
+    pricer::products::VanillaBook book_;
+    std::vector<Trade> others_;
+};
+
+// VaR historique au niveau confidence (0.99...) : opposé du
+// ceil(n (1 - confidence))-ième pire P&L
+double valueAtRisk(pricer::utils::Span<const double> pnl, double confidence);
+
+} 
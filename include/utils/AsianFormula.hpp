@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+#include "core/Payoff.hpp"
+
+namespace pricer::utils {
+
+// Options asiatiques discrètes sous Black–Scholes, prix non actualisés.
+//
+// La moyenne porte sur n = m + k fixings : pastFixings (m valeurs déjà
+// constatées) et k dates futures fixingTimes (triées, > 0). Le payoff
+// porte sur la moyenne totale ; la partie constatée décale le strike
+// effectif des fixings futurs, K* = (n K - somme passée) / k.
+
+// Moyenne géométrique G = (prod_i S(t_i))^(1/n) : ln G est gaussien,
+// formule de Black exacte sur le forward de G.
+double geometricAsianUndiscounted(double S0, double K,
+                                  double r, double q, double sigma,
+                                  const std::vector<double>& fixingTimes,
+                                  pricer::core::OptionType type,
+                                  const std::vector<double>& pastFixings = {});
+
+// Moyenne arithmétique, approximation de Levy : loi log-normale ajustée
+// sur les deux premiers moments exacts de la moyenne discrète.
+double levyAsianUndiscounted(double S0, double K,
+                             double r, double q, double sigma,
+                             const std::vector<double>& fixingTimes,
+                             pricer::core::OptionType type,
+                             const std::vector<double>& pastFixings = {});
+
+// Moyenne arithmétique, approximation de Turnbull–Wakeman : même
+// ajustement log-normal, avec les moments de la moyenne continue sur
+// [t_1, t_k] (adapté aux calendriers denses).
+double turnbullWakemanAsianUndiscounted(double S0, double K,
+                                        double r, double q, double sigma,
+                                        const std::vector<double>& fixingTimes,
+                                        pricer::core::OptionType type,
+                                        const std::vector<double>& pastFixings = {});
+
+// Moyenne arithmétique, approximation de Curran : conditionnement par la
+// moyenne géométrique des fixings futurs.
+double curranAsianUndiscounted(double S0, double K,
+                               double r, double q, double sigma,
+                               const std::vector<double>& fixingTimes,
+                               pricer::core::OptionType type,
+                               const std::vector<double>& pastFixings = {});
+
+} 
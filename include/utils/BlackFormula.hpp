@@ -1,19 +1,77 @@
 #pragma once
 
 #include "core/Payoff.hpp" 
+#include "utils/Span.hpp"
+#include "utils/VectorMath.hpp"
 
 namespace pricer::utils {
 
 // CDF de la loi normale standard
 double normalCdf(double x);
 
+// Inverse de la CDF normale (Acklam + un pas de Halley), p dans ]0,1[
+double inverseNormalCdf(double p);
+
 // Black sur un taux/forward F, strike K, stdDev = sigma * sqrt(T)
 double blackForward(double F, double K, double stdDev,
                     pricer::core::OptionType type);
 
+// Black en lot sur des tableaux contigus de même taille :
+// out[i] = discounts[i] * blackForward(forwards[i], strikes[i], stdDevs[i], types[i]).
+// ln(F/K) et N(.) passent par les noyaux vectoriels (vlog, vnormalCdf) ;
+// écart au scalaire ~1e-15 relatif au forward. Les cas dégénérés
+// (stdDev <= 0, F ou K <= 0) sont délégués à la version scalaire.
+void blackForwardBatch(Span<const double> forwards,
+                       Span<const double> strikes,
+                       Span<const double> stdDevs,
+                       Span<const pricer::core::OptionType> types,
+                       Span<const double> discounts,
+                       Span<double> out);
+void blackForwardBatch(Span<const double> forwards,
+                       Span<const double> strikes,
+                       Span<const double> stdDevs,
+                       Span<const pricer::core::OptionType> types,
+                       Span<const double> discounts,
+                       Span<double> out,
+                       SimdLevel level);
+
+// Écart-type implicite de Black : stdDev tel que
+// blackForward(F, K, stdDev, type) = price (prix non actualisé).
+// Précision machine en quelques itérations de Householder ; lève une
+// exception si le prix sort de ]intrinsèque, borne haute[ (0 à
+// l'intrinsèque exacte).
+double impliedBlackStdDev(double price, double F, double K,
+                          pricer::core::OptionType type);
+
+// Écarts-types implicites d'une chaîne d'options :
+// out[i] = impliedBlackStdDev(prices[i] / discounts[i], ...).
+// Un prix hors bornes donne NaN au lieu d'une exception.
+void impliedBlackStdDevBatch(Span<const double> prices,
+                             Span<const double> forwards,
+                             Span<const double> strikes,
+                             Span<const pricer::core::OptionType> types,
+                             Span<const double> discounts,
+                             Span<double> out);
+
 // Digital cash-or-nothing sur forward F, strike K, stdDev, payoff = Q
 double blackDigitalForward(double F, double K, double stdDev,
                            pricer::core::OptionType type,
                            double payout);
 
+// Prix de Black non actualisé et ses dérivées en F et en stdDev
+struct BlackSensitivities {
+    double value     = 0.0;
+    double dForward  = 0.0;   // dV/dF
+    double dForward2 = 0.0;   // d2V/dF2
+    double dStdDev   = 0.0;   // dV/dstdDev
+};
+
+// Une seule évaluation de d1, d2, N(.) et n(.) pour le prix et ses
+// dérivées ; stdDev <= 0 donne la limite (intrinsèque)
+BlackSensitivities blackForwardSensitivities(double F, double K, double stdDev,
+                                             pricer::core::OptionType type);
+BlackSensitivities blackDigitalForwardSensitivities(double F, double K, double stdDev,
+                                                    pricer::core::OptionType type,
+                                                    double payout);
+
 } 
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace pricer::utils {
+
+// Construction d'un mouvement brownien par pont brownien.
+//
+// Le premier aléa fixe W(T), les suivants les milieux successifs : les
+// premières dimensions d'une suite quasi-aléatoire portent ainsi
+// l'essentiel de la variance du chemin.
+class BrownianBridge {
+public:
+    // Grille uniforme de nSteps pas sur [0, 1]
+    explicit BrownianBridge(std::size_t nSteps);
+
+    // Grille quelconque t_1 < ... < t_n (t_0 = 0 implicite)
+    explicit BrownianBridge(std::vector<double> times);
+
+    std::size_t size() const { return times_.size(); }
+
+    // z : n aléas N(0,1) indépendants (dans l'ordre du pont).
+    // out : incréments normalisés (W(t_i) - W(t_{i-1})) / sqrt(t_i - t_{i-1}),
+    // eux aussi N(0,1) indépendants, dans l'ordre chronologique.
+    // out ne doit pas pointer sur z.
+    void transform(const double* z, double* out) const;
+
+private:
+    void init();
+
+    std::vector<double> times_;
+    std::vector<double> sqrtdt_;
+    std::vector<std::size_t> bridgeIndex_, leftIndex_, rightIndex_;
+    std::vector<double> leftWeight_, rightWeight_, stdDev_;
+};
+
+} 
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+namespace pricer::utils {
+
+// Demande d'annulation partagée entre l'appelant et le calcul (copies
+// légères : toutes les copies voient le même drapeau)
+class CancellationToken {
+public:
+    CancellationToken() : flag_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void cancel() const { flag_->store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return flag_->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> flag_;
+};
+
+// Levée par un calcul interrompu à la demande de l'appelant
+class OperationCancelled : public std::runtime_error {
+public:
+    OperationCancelled() : std::runtime_error("calcul annulé") {}
+};
+
+// Jeton du calcul en cours sur ce thread, nullptr hors calcul annulable.
+// Posé par CancellationScope ; parallelFor le transmet à ses tâches.
+const CancellationToken* currentCancellation();
+
+// Lève OperationCancelled si le calcul en cours a été annulé. Appelé par
+// les moteurs Monte Carlo entre deux blocs de chemins.
+void throwIfCancelled();
+
+// Installe un jeton pour le thread courant, le temps d'une portée
+class CancellationScope {
+public:
+    explicit CancellationScope(const CancellationToken* token);
+    ~CancellationScope();
+
+    CancellationScope(const CancellationScope&) = delete;
+    CancellationScope& operator=(const CancellationScope&) = delete;
+
+private:
+    const CancellationToken* previous_;
+};
+
+} 
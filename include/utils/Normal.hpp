@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <random>
+
+namespace pricer::utils {
+
+// Tirages N(0,1) par la méthode ziggurat (Marsaglia–Tsang, 128 couches,
+// variante de Doornik) sur un mt19937_64.
+//
+// Contrairement à std::normal_distribution, dont l'algorithme dépend de la
+// bibliothèque standard, la suite produite ne dépend que de la seed : les
+// prix sont identiques d'une plateforme à l'autre. Un seul mot de 64 bits
+// suffit dans ~99 % des cas (couche, signe et abscisse), sans branche
+// coûteuse. Pour des uniformes quasi-aléatoires, utiliser plutôt
+// vinverseNormalCdf (transformation monotone, structure de Sobol préservée).
+class ZigguratNormal {
+public:
+    double operator()(std::mt19937_64& gen) const;
+
+    // out[0..n) : n tirages successifs
+    void fill(std::mt19937_64& gen, double* out, std::size_t n) const;
+};
+
+} 
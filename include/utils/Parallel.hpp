@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace pricer::utils {
+
+// Nombre de threads effectif (0 = nombre de coeurs de la machine)
+std::size_t resolveThreadCount(std::size_t nThreads);
+
+// Exécute fn(i) pour i dans [0, n) sur nThreads threads au plus.
+// Les indices sont distribués dynamiquement ; la première exception
+// levée par une tâche est propagée à l'appelant.
+//
+// Les threads viennent du pool courant (defaultThreadPool() hors d'un
+// pool) : l'appelant calcule lui-même et les threads inactifs se joignent
+// à la boucle en volant ses tâches. Appel possible depuis une tâche du
+// pool (Monte Carlo dans un Portfolio) sans interblocage. Le jeton
+// d'annulation de l'appelant (currentCancellation) suit les tâches.
+void parallelFor(std::size_t n, std::size_t nThreads,
+                 const std::function<void(std::size_t)>& fn);
+
+} 
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace pricer::utils {
+
+// Générateur à compteur Philox4x32-10 (Salmon et al., 2011).
+//
+// Chaque bloc de 4 mots de 32 bits est une fonction pure de (clé, compteur) :
+// pas d'état à propager, saut en O(1), et n'importe quel aléa d'une
+// simulation se recalcule isolément.
+class Philox4x32 {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key     = std::array<std::uint32_t, 2>;
+
+    explicit Philox4x32(std::uint64_t seed)
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)} {}
+
+    explicit Philox4x32(Key key) : key_(key) {}
+
+    // Bloc de sortie du compteur ctr (10 tours)
+    Counter operator()(Counter ctr) const;
+
+    // Uniforme dans ]0,1[ (53 bits) associée au couple (path, step) :
+    // le compteur (step / 2, path) fournit les pas 2k et 2k+1.
+    double uniform(std::uint64_t path, std::uint64_t step) const;
+
+    // u[k] = uniform(path, firstStep + k), k dans [0, n)
+    void uniforms(std::uint64_t path, std::uint64_t firstStep,
+                  double* u, std::size_t n) const;
+
+    const Key& key() const { return key_; }
+
+private:
+    Key key_;
+};
+
+// Flux séquentiel de mots de 32 bits sur Philox4x32-10, utilisable comme
+// UniformRandomBitGenerator de la bibliothèque standard. discard() est en
+// O(1) : il ne fait qu'avancer le compteur.
+class PhiloxEngine {
+public:
+    using result_type = std::uint32_t;
+
+    explicit PhiloxEngine(std::uint64_t seed, std::uint64_t stream = 0)
+        : philox_(seed),
+          counter_{0, 0, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)} {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()();
+
+    void discard(std::uint64_t n);
+
+private:
+    Philox4x32 philox_;
+    Philox4x32::Counter counter_;
+    Philox4x32::Counter output_{};
+    std::size_t used_ = 4;  // mots déjà consommés dans output_
+};
+
+} 
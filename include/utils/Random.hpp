@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+#include <random>
+
+namespace pricer::utils {
+
+// Générateur du sous-flux numéro `stream` dérivé de `seed`.
+// Deux sous-flux distincts sont statistiquement indépendants et
+// reproductibles quel que soit l'ordre dans lequel ils sont créés.
+std::mt19937_64 makeSubstream(unsigned long seed, std::size_t stream);
+
+} 
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pricer::utils {
+
+// Suite à discrépance faible de Sobol (base 2, 32 bits).
+//
+// Les polynômes primitifs sont énumérés par degré croissant (ordre de
+// Joe–Kuo) ; les nombres directeurs initiaux sont tirés de façon
+// déterministe (initialisation de Jäckel). Le brouillage optionnel combine
+// un brouillage linéaire de Matoušek et un décalage digital aléatoire :
+// chaque seed donne une réplication indépendante et sans biais.
+class SobolSequence {
+public:
+    static constexpr std::size_t maxDimension = 21201;
+
+    explicit SobolSequence(std::size_t dimension);
+    SobolSequence(std::size_t dimension, unsigned long scrambleSeed);
+
+    std::size_t dimension() const { return dimension_; }
+
+    // Positionne la suite : le prochain point renvoyé est le point `index`
+    void skipTo(std::uint64_t index);
+
+    // Remplit u[0..dimension) avec le point courant (dans ]0,1[) et avance
+    void next(double* u);
+
+private:
+    void initDirections(bool scrambled, unsigned long scrambleSeed);
+
+    std::size_t dimension_;
+    std::vector<std::uint32_t> directions_;  // [bit * dimension + d]
+    std::vector<std::uint32_t> shift_;
+    std::vector<std::uint32_t> state_;
+    std::uint64_t index_ = 0;
+};
+
+} 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace pricer::utils {
+
+// Vue non possédante sur un tableau contigu (équivalent minimal de
+// std::span, absent en C++17). Se construit depuis un pointeur et une
+// taille, un tableau C ou tout conteneur exposant data() et size().
+template <class T>
+class Span {
+public:
+    constexpr Span() noexcept = default;
+
+    constexpr Span(T* data, std::size_t size) noexcept
+        : data_(data), size_(size) {}
+
+    template <std::size_t N>
+    constexpr Span(T (&array)[N]) noexcept
+        : data_(array), size_(N) {}
+
+    template <class Container,
+              class = std::enable_if_t<std::is_convertible_v<
+                  decltype(std::declval<Container&>().data()), T*>>>
+    constexpr Span(Container& c) noexcept
+        : data_(c.data()), size_(c.size()) {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr T& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+
+    constexpr Span subspan(std::size_t offset, std::size_t count) const noexcept {
+        return Span(data_ + offset, count);
+    }
+
+private:
+    T* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} 
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pricer::utils {
+
+// Pool de threads de taille fixe à vol de tâches. Chaque thread a sa file :
+// il dépile ses propres tâches par la fin (les dernières créées, encore
+// chaudes en cache), et un thread inactif vole par le début de la file d'un
+// autre (les plus anciennes, donc les plus grosses). Les tâches soumises
+// hors du pool passent par une file commune, servie dans l'ordre.
+//
+// Depuis une tâche du pool, attendre une autre tâche par wait() plutôt
+// que future::get() seul ; parallelFor, qui participe au calcul, n'a pas
+// ce problème.
+class ThreadPool {
+public:
+    // nThreads = 0 : nombre de coeurs de la machine
+    explicit ThreadPool(std::size_t nThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const { return workers_.size(); }
+
+    // Résultat (ou exception) de fn rendu par future::get()
+    template <class F>
+    auto submit(F&& fn) -> std::future<std::invoke_result_t<std::decay_t<F>&>> {
+        using R = std::invoke_result_t<std::decay_t<F>&>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+        std::future<R> result = task->get_future();
+        enqueue([task] { (*task)(); });
+        return result;
+    }
+
+    // Sans futur : fn ne doit pas lever d'exception
+    void post(std::function<void()> fn) { enqueue(std::move(fn)); }
+
+    // Attend un futur de ce pool. Depuis un de ses threads, exécute les
+    // tâches en attente au lieu de bloquer (pas d'interblocage).
+    template <class T>
+    void wait(const std::future<T>& f) {
+        if (current() != this) {
+            f.wait();
+            return;
+        }
+        while (f.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!runPendingTask()) {
+                f.wait_for(std::chrono::microseconds(100));
+            }
+        }
+    }
+
+    // Pool du thread appelant s'il en est un thread, nullptr sinon
+    static ThreadPool* current();
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void enqueue(std::function<void()> task);
+    bool runPendingTask();
+    bool pop(std::size_t self, std::function<void()>& task);
+    void workerLoop(std::size_t self);
+
+    std::vector<std::unique_ptr<Queue>> local_;
+    Queue injected_;
+
+    // Sous mutex_ : endormissement des threads sans tâche
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::size_t pending_ = 0;
+    bool stopping_ = false;
+
+    std::vector<std::thread> workers_;
+};
+
+// Pool partagé de la bibliothèque (un thread par coeur), créé au premier appel
+ThreadPool& defaultThreadPool();
+
+} 
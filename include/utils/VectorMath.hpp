@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+namespace pricer::utils {
+
+// Jeux d'instructions vectoriels utilisables par les noyaux de calcul
+enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+// Meilleur niveau supporté par le processeur (détecté une seule fois)
+SimdLevel detectSimdLevel();
+
+const char* simdLevelName(SimdLevel level);
+
+// y[i] = exp(x[i]), x dans [-708, 709].
+// Les versions vectorielles (AVX2/AVX-512) sont précises à ~2 ulp ; la
+// version scalaire utilise std::exp.
+void vexp(const double* x, double* y, std::size_t n);
+void vexp(const double* x, double* y, std::size_t n, SimdLevel level);
+
+// y[i] = log(x[i]), x > 0 normalisé
+void vlog(const double* x, double* y, std::size_t n);
+void vlog(const double* x, double* y, std::size_t n, SimdLevel level);
+
+// y[i] = N^-1(u[i]), u dans ]0,1[ (approximation d'Acklam sans
+// raffinement, erreur relative < 1.2e-9 ; suffisante pour la simulation)
+void vinverseNormalCdf(const double* u, double* y, std::size_t n);
+void vinverseNormalCdf(const double* u, double* y, std::size_t n, SimdLevel level);
+
+// y[i] = N(x[i]), CDF normale standard. Les versions vectorielles
+// évaluent erfc par un développement de Tchebychev (erreur relative
+// ~1e-15, y compris dans la queue) ; N(x) est ramené à 0 sous x = -37.4.
+// La version scalaire utilise normalCdf.
+void vnormalCdf(const double* x, double* y, std::size_t n);
+void vnormalCdf(const double* x, double* y, std::size_t n, SimdLevel level);
+
+// Fonction d'erreur complémentaire réduite erfcx(x) = exp(x^2) erfc(x),
+// même développement de Tchebychev que vnormalCdf (x >= 0), réflexion
+// erfcx(x) = 2 exp(x^2) - erfcx(-x) sinon
+double erfcx(double x);
+
+} 
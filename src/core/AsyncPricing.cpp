@@ -0,0 +1,32 @@
+#include "core/AsyncPricing.hpp"
+#include "core/PricingEngine.hpp"
+
+namespace pricer::core {
+
+PricingFuture<PricingResults>
+priceAsync(std::shared_ptr<const Instrument> inst, pricer::utils::ThreadPool& pool) {
+    pricer::utils::CancellationToken token;
+    auto future = pool.submit([inst = std::move(inst), token] {
+        pricer::utils::CancellationScope scope(&token);
+        pricer::utils::throwIfCancelled();
+        const auto& engine = inst->pricingEngine();
+        if (!engine) {
+            return PricingResults{};
+        }
+        return engine->calculateResults(*inst);
+    });
+    return {std::move(future), std::move(token)};
+}
+
+PricingFuture<PortfolioResults>
+priceAsync(const Portfolio& book, pricer::utils::ThreadPool& pool, std::size_t chunkSize) {
+    pricer::utils::CancellationToken token;
+    auto future = pool.submit([&book, &pool, chunkSize, token] {
+        pricer::utils::CancellationScope scope(&token);
+        pricer::utils::throwIfCancelled();
+        return book.price(pool, chunkSize);
+    });
+    return {std::move(future), std::move(token)};
+}
+
+} 
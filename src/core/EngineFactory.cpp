@@ -1,6 +1,7 @@
 #include "core/EngineFactory.hpp"
 
 #include "core/Instrument.hpp"
+#include "core/Payoff.hpp"
 
 // Produits
 #include "products/EuropeanOption.hpp"
@@ -14,7 +15,9 @@
 #include "engines/EuropeanOptionBSEngine.hpp"
 #include "engines/DigitalOptionBSEngine.hpp"
 #include "engines/AsianOptionMCEngine.hpp"
+#include "engines/AsianOptionAnalyticEngine.hpp"
 #include "engines/BarrierOptionMCEngine.hpp"
+#include "engines/BarrierOptionAnalyticEngine.hpp"
 #include "engines/CapFloorEngines.hpp"
 #include "engines/SwapEngines.hpp"
 
@@ -22,71 +25,150 @@
 
 namespace pricer::core {
 
-std::shared_ptr<PricingEngine>
-EngineFactory::createEngine(const Instrument& inst) const {
+EngineFactory::EngineFactory(std::shared_ptr<pricer::models::BlackScholesModel> equityModel,
+                             std::shared_ptr<pricer::models::BlackIRModel> irModel)
+    : equityModel_(std::move(equityModel)),
+      irModel_(std::move(irModel))
+{
+    registerDefaults();
+}
+
+void EngineFactory::registerDefaults() {
     using namespace pricer;
 
     // ======== Equity ========
 
-    if (auto const* opt = dynamic_cast<const products::EuropeanOption*>(&inst)) {
-        (void)opt; // non utilisé, juste pour le cast
-        return std::make_shared<engines::EuropeanOptionBSEngine>(equityModel_);
-    }
-
-    if (auto const* opt = dynamic_cast<const products::DigitalOption*>(&inst)) {
-        (void)opt;
-        return std::make_shared<engines::DigitalOptionBSEngine>(equityModel_);
-    }
-
-    if (auto const* opt = dynamic_cast<const products::AsianOption*>(&inst)) {
-        (void)opt;
-        // paramètres MC par défaut
-        return std::make_shared<engines::AsianOptionMCEngine>(
-            equityModel_,
+    registerEngine<products::EuropeanOption>([](const EngineFactory& f, const Instrument&) {
+        return f.shared<engines::EuropeanOptionBSEngine>(f.equityModel());
+    });
+
+    registerEngine<products::DigitalOption>([](const EngineFactory& f, const Instrument&) {
+        return f.shared<engines::DigitalOptionBSEngine>(f.equityModel());
+    });
+
+    registerEngine<products::AsianOption>([](const EngineFactory& f, const Instrument& inst) {
+        auto const& opt = static_cast<const products::AsianOption&>(inst);
+        // payoff vanille : approximation de Curran (exacte en géométrique)
+        if (payoffAs<PlainVanillaPayoff>(opt.payoff())) {
+            return f.shared<engines::AsianOptionAnalyticEngine>(f.equityModel());
+        }
+        // sinon paramètres MC par défaut, blocs de chemins répartis sur le
+        // pool (prix indépendant du nombre de threads)
+        engines::MonteCarloSettings settings;
+        settings.nThreads = 0;
+        return f.shared<engines::AsianOptionMCEngine>(
+            f.equityModel(),
             10000,  // nPaths
             50,     // nSteps
-            777UL   // seed
+            777UL,  // seed
+            settings
         );
-    }
-
-    if (auto const* opt = dynamic_cast<const products::BarrierOption*>(&inst)) {
-        (void)opt;
-        return std::make_shared<engines::BarrierOptionMCEngine>(
-            equityModel_,
+    });
+
+    registerEngine<products::BarrierOption>([](const EngineFactory& f, const Instrument& inst) {
+        auto const& opt = static_cast<const products::BarrierOption&>(inst);
+        // payoff vanille : formule fermée (Reiner–Rubinstein)
+        if (payoffAs<PlainVanillaPayoff>(opt.payoff())) {
+            return f.shared<engines::BarrierOptionAnalyticEngine>(f.equityModel());
+        }
+        // sinon Monte Carlo, surveillance continue par pont brownien
+        engines::MonteCarloSettings settings;
+        settings.nThreads = 0;
+        settings.barrierMonitoring = engines::BarrierMonitoring::Continuous;
+        return f.shared<engines::BarrierOptionMCEngine>(
+            f.equityModel(),
             10000,
-            252,
-            2024UL
+            20,
+            2024UL,
+            settings
         );
-    }
+    });
 
     // ======== Taux ========
 
-    if (auto const* caplet = dynamic_cast<const products::Caplet*>(&inst)) {
-        (void)caplet;
-        return std::make_shared<engines::CapletBlackEngine>(irModel_);
-    }
+    // Floorlet dérive de Caplet : même moteur, enregistré explicitement
+    auto caplet = [](const EngineFactory& f, const Instrument&) {
+        return f.shared<engines::CapletBlackEngine>(f.irModel());
+    };
+    registerEngine<products::Caplet>(caplet);
+    registerEngine<products::Floorlet, products::Caplet>(caplet);
+
+    registerEngine<products::Cap>([](const EngineFactory& f, const Instrument&) {
+        return f.shared<engines::CapBlackEngine>(f.irModel());
+    });
 
-    if (auto const* cap = dynamic_cast<const products::Cap*>(&inst)) {
-        (void)cap;
-        return std::make_shared<engines::CapBlackEngine>(irModel_);
+    registerEngine<products::Floor>([](const EngineFactory& f, const Instrument&) {
+        return f.shared<engines::FloorBlackEngine>(f.irModel());
+    });
+
+    registerEngine<products::InterestRateSwap>([](const EngineFactory& f, const Instrument&) {
+        return f.shared<engines::SwapEngine>(f.irModel());
+    });
+
+    registerEngine<products::Swaption>([](const EngineFactory& f, const Instrument&) {
+        return f.shared<engines::SwaptionBlackEngine>(f.irModel());
+    });
+}
+
+const EngineFactory::Entry& EngineFactory::findEntry(const Instrument& inst) const {
+    // Table figée : lecture sans verrou pour les types enregistrés
+    if (!frozen_.load(std::memory_order_relaxed)) {
+        frozen_.store(true, std::memory_order_release);
     }
+    if (auto it = registry_.find(std::type_index(typeid(inst))); it != registry_.end()) {
+        return it->second;
+    }
+    return resolveDerived(inst);
+}
 
-    if (auto const* floor = dynamic_cast<const products::Floor*>(&inst)) {
-        (void)floor;
-        return std::make_shared<engines::FloorBlackEngine>(irModel_);
+bool EngineFactory::refines(const Entry& entry, std::type_index base) const {
+    // Remonte les parents déclarés à l'enregistrement
+    for (const Entry* e = &entry;;) {
+        if (e->parent == base) return true;
+        auto it = registry_.find(e->parent);
+        if (it == registry_.end()) return false;
+        e = &it->second;
     }
+}
 
-    if (auto const* swap = dynamic_cast<const products::InterestRateSwap*>(&inst)) {
-        (void)swap;
-        return std::make_shared<engines::SwapEngine>(irModel_);
+const EngineFactory::Entry& EngineFactory::resolveDerived(const Instrument& inst) const {
+    std::type_index type(typeid(inst));
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (auto it = derived_.find(type); it != derived_.end()) {
+            return *it->second;
+        }
     }
 
-    if (auto const* swpt = dynamic_cast<const products::Swaption*>(&inst)) {
-        (void)swpt;
-        return std::make_shared<engines::SwaptionBlackEngine>(irModel_);
+    // Type dérivé de produits enregistrés, résolu une seule fois : la règle
+    // qui affine toutes les autres règles acceptant l'instrument
+    const Entry* best = nullptr;
+    std::type_index bestType = type;
+    for (const auto& [key, entry] : registry_) {
+        if (entry.matches(inst) && (!best || refines(entry, bestType))) {
+            best = &entry;
+            bestType = key;
+        }
     }
+    if (!best) {
+        throw std::runtime_error("EngineFactory::createEngine: type d'instrument non supporté");
+    }
+    for (const auto& [key, entry] : registry_) {
+        if (&entry != best && entry.matches(inst) && !refines(*best, key)) {
+            throw std::runtime_error("EngineFactory::createEngine: règles ambiguës pour le type "
+                                     "d'instrument (parent non déclaré à l'enregistrement)");
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    derived_[type] = best;
+    return *best;
+}
 
-    throw std::runtime_error("EngineFactory::createEngine: type d'instrument non supporté");
+std::shared_ptr<PricingEngine>
+EngineFactory::createEngine(const Instrument& inst) const {
+    // Creator appelé hors verrou : il repasse par shared()
+    return findEntry(inst).create(*this, inst);
 }
 
 } 
@@ -1,17 +1,116 @@
 #include "core/Instrument.hpp"
 #include "core/PricingEngine.hpp"
 
+#include <utility>
+
 namespace pricer::core {
 
+Instrument::Instrument(const Instrument& other)
+    : Observer(other), pricingEngine_(other.pricingEngine_) {
+    std::lock_guard<std::mutex> lock(other.mutex_);
+    npv_     = other.npv_;
+    results_ = other.results_;
+}
+
+Instrument& Instrument::operator=(const Instrument& other) {
+    if (this == &other) {
+        return *this;
+    }
+    Observer::operator=(other);
+    pricingEngine_ = other.pricingEngine_;
+    std::optional<double> npv;
+    std::shared_ptr<const PricingResults> results;
+    {
+        std::lock_guard<std::mutex> lock(other.mutex_);
+        npv     = other.npv_;
+        results = other.results_;
+    }
+    // Nouvelle époque : un calcul en cours sur l'ancien état est écarté
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++epoch_;
+    npv_     = npv;
+    results_ = std::move(results);
+    return *this;
+}
+
+Instrument::~Instrument() {
+    // Avant la destruction de npv_ / results_, lus par update()
+    unregisterAll();
+}
+
 void Instrument::setPricingEngine(std::shared_ptr<PricingEngine> engine) {
+    if (pricingEngine_) {
+        unregisterWith(pricingEngine_);
+    }
     pricingEngine_ = std::move(engine);
+    registerWith(pricingEngine_);
+    update();
 }
 
 double Instrument::NPV() const {
     if (!pricingEngine_) {
         return 0.0;
     }
-    return pricingEngine_->calculate(*this);
+    std::uint64_t epoch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (npv_) {
+            return *npv_;
+        }
+        epoch = epoch_;
+    }
+    double npv = pricingEngine_->calculate(*this);
+    keepNPV(npv, epoch);
+    return npv;
+}
+
+PricingResults Instrument::results() const {
+    if (!pricingEngine_) {
+        return PricingResults{};
+    }
+    std::uint64_t epoch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (results_) {
+            return *results_;
+        }
+        epoch = epoch_;
+    }
+    auto results = std::make_shared<const PricingResults>(pricingEngine_->calculateResults(*this));
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (epoch_ == epoch) {
+        results_ = results;
+        npv_     = results->npv;
+    }
+    return *results;
+}
+
+void Instrument::update() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++epoch_;
+    npv_.reset();
+    results_.reset();
+}
+
+std::uint64_t Instrument::cacheEpoch(BatchAccess) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return epoch_;
+}
+
+std::optional<double> Instrument::cachedNPV(BatchAccess) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return npv_;
+}
+
+void Instrument::storeNPV(double npv, std::uint64_t epoch, BatchAccess) const {
+    keepNPV(npv, epoch);
+}
+
+void Instrument::keepNPV(double npv, std::uint64_t epoch) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (epoch_ == epoch && !npv_) {
+        npv_ = npv;
+    }
 }
 
 } 
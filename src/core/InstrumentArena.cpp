@@ -0,0 +1,24 @@
+#include "core/InstrumentArena.hpp"
+
+namespace pricer::core {
+
+InstrumentArena::InstrumentArena(std::size_t initialBytes)
+    : resource_(initialBytes)
+{}
+
+InstrumentArena::~InstrumentArena() {
+    release();
+}
+
+void InstrumentArena::release() {
+    // Ordre inverse de création : un objet ne survit pas à ce qu'il utilise
+    while (cleanups_) {
+        Cleanup* node = cleanups_;
+        cleanups_ = node->next;
+        node->destroy(node->object);
+    }
+    objects_ = 0;
+    resource_.release();
+}
+
+} 
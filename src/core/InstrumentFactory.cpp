@@ -23,13 +23,15 @@ InstrumentFactory::makeAsianOption(OptionType type, double K, double T) {
 }
 
 pricer::products::BarrierOption
-InstrumentFactory::makeUpAndOutOption(OptionType type, double K, double T, double barrier) {
+InstrumentFactory::makeUpAndOutOption(OptionType type, double K, double T, double barrier,
+                                      double rebate) {
     auto payoff = std::make_unique<PlainVanillaPayoff>(type, K);
     return pricer::products::BarrierOption(
         std::move(payoff),
         T,
         barrier,
-        pricer::products::BarrierType::UpAndOut
+        pricer::products::BarrierType::UpAndOut,
+        rebate
     );
 }
 
@@ -72,4 +74,67 @@ InstrumentFactory::makeSwaption(const pricer::products::InterestRateSwap& underl
     return pricer::products::Swaption(underlying, exerciseTime);
 }
 
+// ==== Mode arène ====
+
+pricer::products::EuropeanOption*
+InstrumentFactory::makeEuropeanOption(InstrumentArena& arena, OptionType type, double K, double T) {
+    return arena.create<pricer::products::EuropeanOption>(
+        arena.makePayoff<PlainVanillaPayoff>(type, K), T);
+}
+
+pricer::products::DigitalOption*
+InstrumentFactory::makeDigitalOption(InstrumentArena& arena, OptionType type, double K, double T,
+                                     double payout) {
+    return arena.create<pricer::products::DigitalOption>(
+        arena.makePayoff<DigitalPayoff>(type, K, payout), T);
+}
+
+pricer::products::AsianOption*
+InstrumentFactory::makeAsianOption(InstrumentArena& arena, OptionType type, double K, double T) {
+    return arena.create<pricer::products::AsianOption>(
+        arena.makePayoff<PlainVanillaPayoff>(type, K), T);
+}
+
+pricer::products::BarrierOption*
+InstrumentFactory::makeUpAndOutOption(InstrumentArena& arena, OptionType type, double K, double T,
+                                      double barrier, double rebate) {
+    return arena.create<pricer::products::BarrierOption>(
+        arena.makePayoff<PlainVanillaPayoff>(type, K),
+        T,
+        barrier,
+        pricer::products::BarrierType::UpAndOut,
+        rebate
+    );
+}
+
+pricer::products::Caplet*
+InstrumentFactory::makeCaplet(InstrumentArena& arena, double notional, double strike, double forward,
+                              double start, double end, double yearFraction) {
+    return arena.create<pricer::products::Caplet>(
+        notional, strike, forward, start, end, yearFraction, OptionType::Call);
+}
+
+pricer::products::InterestRateSwap*
+InstrumentFactory::makeSwap(InstrumentArena& arena,
+                            double notional,
+                            double fixedRate,
+                            const std::vector<double>& paymentTimes,
+                            const std::vector<double>& accruals,
+                            double forwardRate,
+                            bool payer) {
+    // échéancier copié dans l'arène
+    return arena.create<pricer::products::InterestRateSwap>(
+        notional, fixedRate,
+        pricer::utils::Span<const double>(paymentTimes),
+        pricer::utils::Span<const double>(accruals),
+        forwardRate, payer, arena.resource());
+}
+
+pricer::products::Swaption*
+InstrumentFactory::makeSwaption(InstrumentArena& arena,
+                                const pricer::products::InterestRateSwap& underlying,
+                                double exerciseTime) {
+    return arena.create<pricer::products::Swaption>(underlying, exerciseTime, arena.resource());
+}
+
 } 
@@ -0,0 +1,75 @@
+#include "core/Observable.hpp"
+
+#include <algorithm>
+
+namespace pricer::core {
+
+void Observable::notifyObservers() {
+    // Verrou tenu jusqu'au bout : aucun observateur ne peut être détruit
+    // entre la copie et son update(). La copie protège l'itération si un
+    // update() (même thread) modifie l'ensemble ; un observateur retiré
+    // entre-temps n'est pas appelé.
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    std::vector<Observer*> observers(observers_.begin(), observers_.end());
+    for (Observer* observer : observers) {
+        if (observers_.count(observer) != 0) {
+            observer->update();
+        }
+    }
+}
+
+void Observable::registerObserver(Observer* observer) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    observers_.insert(observer);
+}
+
+void Observable::unregisterObserver(Observer* observer) {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    observers_.erase(observer);
+}
+
+Observer::Observer(const Observer& other) {
+    for (const auto& observable : other.observables_) {
+        registerWith(observable);
+    }
+}
+
+Observer& Observer::operator=(const Observer& other) {
+    if (this != &other) {
+        unregisterAll();
+        for (const auto& observable : other.observables_) {
+            registerWith(observable);
+        }
+    }
+    return *this;
+}
+
+Observer::~Observer() {
+    unregisterAll();
+}
+
+void Observer::registerWith(const std::shared_ptr<Observable>& observable) {
+    if (!observable) return;
+    if (std::find(observables_.begin(), observables_.end(), observable) != observables_.end()) {
+        return;
+    }
+    observable->registerObserver(this);
+    observables_.push_back(observable);
+}
+
+void Observer::unregisterWith(const std::shared_ptr<Observable>& observable) {
+    auto it = std::find(observables_.begin(), observables_.end(), observable);
+    if (it != observables_.end()) {
+        (*it)->unregisterObserver(this);
+        observables_.erase(it);
+    }
+}
+
+void Observer::unregisterAll() {
+    for (const auto& observable : observables_) {
+        observable->unregisterObserver(this);
+    }
+    observables_.clear();
+}
+
+} 
@@ -1,25 +1,57 @@
 #include "core/Payoff.hpp"
+#include "core/PayoffKernels.hpp"
 
 #include <algorithm>
+#include <typeinfo>
 
 namespace pricer::core {
 
+void Payoff::evaluate(const double* spots, double* out, std::size_t n) const {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = (*this)(spots[i]);
+    }
+}
+
 double PlainVanillaPayoff::operator()(double spot) const {
     if (type_ == OptionType::Call) {
-        return std::max(spot - strike_, 0.0);
+        return VanillaKernel<OptionType::Call>{strike_}(spot);
     } else {
-        return std::max(strike_ - spot, 0.0);
+        return VanillaKernel<OptionType::Put>{strike_}(spot);
+    }
+}
+
+void PlainVanillaPayoff::evaluate(const double* spots, double* out, std::size_t n) const {
+    // Classe dérivée : son operator() peut différer du noyau
+    if (typeid(*this) != typeid(PlainVanillaPayoff)) {
+        Payoff::evaluate(spots, out, n);
+        return;
+    }
+    if (type_ == OptionType::Call) {
+        applyPayoff(VanillaKernel<OptionType::Call>{strike_}, spots, out, n);
+    } else {
+        applyPayoff(VanillaKernel<OptionType::Put>{strike_}, spots, out, n);
     }
 }
 
 double DigitalPayoff::operator()(double spot) const {
-    bool inTheMoney = false;
     if (type_ == OptionType::Call) {
-        inTheMoney = (spot > strike_);
+        return DigitalKernel<OptionType::Call>{strike_, payout_}(spot);
+    } else {
+        return DigitalKernel<OptionType::Put>{strike_, payout_}(spot);
+    }
+}
+
+void DigitalPayoff::evaluate(const double* spots, double* out, std::size_t n) const {
+    // Classe dérivée : son operator() peut différer du noyau
+    if (typeid(*this) != typeid(DigitalPayoff)) {
+        Payoff::evaluate(spots, out, n);
+        return;
+    }
+    if (type_ == OptionType::Call) {
+        applyPayoff(DigitalKernel<OptionType::Call>{strike_, payout_}, spots, out, n);
     } else {
-        inTheMoney = (spot < strike_);
+        applyPayoff(DigitalKernel<OptionType::Put>{strike_, payout_}, spots, out, n);
     }
-    return inTheMoney ? payout_ : 0.0;
 }
 
 
@@ -0,0 +1,216 @@
+#include "core/Portfolio.hpp"
+
+#include "core/EngineFactory.hpp"
+#include "utils/Cancellation.hpp"
+#include "utils/ThreadPool.hpp"
+
+#include "products/EuropeanOption.hpp"
+#include "products/DigitalOption.hpp"
+#include "products/AsianOption.hpp"
+#include "products/BarrierOption.hpp"
+#include "products/CapFloor.hpp"
+#include "products/Swap.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace pricer::core {
+
+namespace {
+
+struct Label {
+    const char* product;
+    const char* model;
+};
+
+Label classify(const Instrument& inst) {
+    using namespace pricer::products;
+
+    if (instrumentAs<EuropeanOption>(inst))   return {"EuropeanOption", "BlackScholes"};
+    if (instrumentAs<DigitalOption>(inst))    return {"DigitalOption", "BlackScholes"};
+    if (instrumentAs<AsianOption>(inst))      return {"AsianOption", "BlackScholes"};
+    if (instrumentAs<BarrierOption>(inst))    return {"BarrierOption", "BlackScholes"};
+    // Floorlet dérive de Caplet : testé avant
+    if (instrumentAs<Floorlet>(inst))         return {"Floorlet", "BlackIR"};
+    if (instrumentAs<Caplet>(inst))           return {"Caplet", "BlackIR"};
+    if (instrumentAs<Cap>(inst))              return {"Cap", "BlackIR"};
+    if (instrumentAs<Floor>(inst))            return {"Floor", "BlackIR"};
+    if (instrumentAs<InterestRateSwap>(inst)) return {"InterestRateSwap", "BlackIR"};
+    if (instrumentAs<Swaption>(inst))         return {"Swaption", "BlackIR"};
+    return {"Autre", "Autre"};
+}
+
+// Paquet de formules fermées : un calculateBatch par suite de trades
+// partageant le même moteur ; les prix vont aussi au cache des instruments
+// si leur époque n'a pas changé depuis le début de price()
+void priceChunk(const std::vector<const Instrument*>& book,
+                const std::vector<std::uint64_t>& epochs,
+                const std::size_t* index, std::size_t n, double* npvs,
+                Instrument::BatchAccess access)
+{
+    std::vector<const Instrument*> group;
+    std::vector<double> out;
+    std::size_t k = 0;
+    while (k < n) {
+        const PricingEngine* engine = book[index[k]]->pricingEngine().get();
+        std::size_t end = k;
+        group.clear();
+        while (end < n && book[index[end]]->pricingEngine().get() == engine) {
+            group.push_back(book[index[end]]);
+            ++end;
+        }
+        out.resize(group.size());
+        engine->calculateBatch({group.data(), group.size()}, {out.data(), out.size()});
+        for (std::size_t j = k; j < end; ++j) {
+            npvs[index[j]] = out[j - k];
+            group[j - k]->storeNPV(out[j - k], epochs[index[j]], access);
+        }
+        k = end;
+    }
+}
+
+} 
+
+void Portfolio::add(std::shared_ptr<Instrument> inst) {
+    if (!inst) {
+        throw std::runtime_error("Portfolio: instrument nul");
+    }
+    Label label = classify(*inst);
+    trades_.push_back(Trade{std::move(inst), label.product, label.model});
+}
+
+void Portfolio::add(std::shared_ptr<Instrument> inst, std::shared_ptr<PricingEngine> engine) {
+    if (inst) {
+        inst->setPricingEngine(std::move(engine));
+    }
+    add(std::move(inst));
+}
+
+void Portfolio::assignEngines(const EngineFactory& factory) {
+    for (auto& trade : trades_) {
+        if (!trade.instrument->pricingEngine()) {
+            trade.instrument->setPricingEngine(factory.createEngine(*trade.instrument));
+        }
+    }
+}
+
+PortfolioResults Portfolio::price(pricer::utils::ThreadPool& pool, std::size_t chunkSize) const {
+    if (chunkSize == 0) {
+        throw std::runtime_error("Portfolio: taille de paquet nulle");
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    std::size_t n = trades_.size();
+    std::vector<const Instrument*> book(n);
+    std::vector<std::uint64_t> epochs(n);
+    // Calculs coûteux : un trade, ou tous ceux d'un moteur à calcul partagé
+    std::vector<std::pair<double, std::vector<std::size_t>>> heavy;
+    std::map<const PricingEngine*, std::size_t> sharedJob;
+    std::vector<std::size_t> light;
+    Instrument::BatchAccess access;
+
+    PortfolioResults res;
+    res.npvs.assign(n, 0.0);
+    double* npvs = res.npvs.data();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const Instrument& inst = *trades_[i].instrument;
+        book[i] = &inst;
+        const auto& engine = inst.pricingEngine();
+        if (!engine) continue;  // NPV nul
+        // Époque avant le cache : un tick entre les deux écarte le prix
+        // calculé ici, pas celui déjà en cache
+        epochs[i] = inst.cacheEpoch(access);
+        // Prix en cache toujours valide : ni tâche ni calcul
+        if (auto cached = inst.cachedNPV(access)) {
+            npvs[i] = *cached;
+            continue;
+        }
+        double cost = engine->estimatedCost(inst);
+        if (engine->sharesCalculation()) {
+            // Le premier trade paie la simulation, les autres lisent son
+            // cache : une seule tâche plutôt que des workers bloqués
+            auto slot = sharedJob.try_emplace(engine.get(), heavy.size());
+            if (slot.second) {
+                heavy.emplace_back(cost, std::vector<std::size_t>{});
+            }
+            heavy[slot.first->second].second.push_back(i);
+        } else if (cost > 1.0) {
+            heavy.emplace_back(cost, std::vector<std::size_t>{i});
+        } else {
+            light.push_back(i);
+        }
+    }
+
+    // Plus long d'abord : le lot ne finit pas sur un Monte Carlo parti tard
+    std::stable_sort(heavy.begin(), heavy.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+    std::stable_sort(light.begin(), light.end(), [&](std::size_t a, std::size_t b) {
+        return std::less<const PricingEngine*>()(book[a]->pricingEngine().get(),
+                                                 book[b]->pricingEngine().get());
+    });
+
+    std::vector<std::future<void>> jobs;
+    jobs.reserve(heavy.size() + (light.size() + chunkSize - 1) / chunkSize);
+    // Jeton de l'appelant, repris par chaque tâche
+    const pricer::utils::CancellationToken* token = pricer::utils::currentCancellation();
+
+    for (const auto& job : heavy) {
+        const std::vector<std::size_t>* trades = &job.second;
+        jobs.push_back(pool.submit([&book, npvs, trades, token] {
+            pricer::utils::CancellationScope scope(token);
+            pricer::utils::throwIfCancelled();
+            for (std::size_t i : *trades) {
+                npvs[i] = book[i]->NPV();
+            }
+        }));
+    }
+    for (std::size_t first = 0; first < light.size(); first += chunkSize) {
+        std::size_t count = std::min(chunkSize, light.size() - first);
+        const std::size_t* index = light.data() + first;
+        jobs.push_back(pool.submit([&book, &epochs, index, count, npvs, access, token] {
+            pricer::utils::CancellationScope scope(token);
+            pricer::utils::throwIfCancelled();
+            priceChunk(book, epochs, index, count, npvs, access);
+        }));
+    }
+
+    // Toutes les tâches terminées avant de propager la première erreur
+    std::exception_ptr error;
+    for (auto& job : jobs) {
+        try {
+            pool.wait(job);
+            job.get();
+        } catch (...) {
+            if (!error) error = std::current_exception();
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    // Agrégats dans l'ordre du livre : résultat indépendant du pool
+    for (std::size_t i = 0; i < n; ++i) {
+        res.total += npvs[i];
+        res.byProduct[trades_[i].product] += npvs[i];
+        res.byModel[trades_[i].model] += npvs[i];
+    }
+
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+PortfolioResults Portfolio::price() const {
+    return price(pricer::utils::defaultThreadPool());
+}
+
+} 
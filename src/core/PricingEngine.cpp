@@ -1,4 +1,33 @@
 #include "core/PricingEngine.hpp"
 
+#include <chrono>
+#include <stdexcept>
+
 namespace pricer::core {
+
+PricingResults PricingEngine::resultsImpl(const Instrument& inst) const {
+    auto start = std::chrono::steady_clock::now();
+
+    PricingResults res;
+    res.npv = priceImpl(inst);
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+void PricingEngine::calculateBatch(pricer::utils::Span<const Instrument* const> instruments,
+                                   pricer::utils::Span<double> out) const {
+    if (instruments.size() != out.size()) {
+        throw std::runtime_error("PricingEngine::calculateBatch: tableaux de tailles différentes");
+    }
+    batchImpl(instruments, out);
+}
+
+void PricingEngine::batchImpl(pricer::utils::Span<const Instrument* const> instruments,
+                              pricer::utils::Span<double> out) const {
+    for (std::size_t i = 0; i < instruments.size(); ++i) {
+        out[i] = priceImpl(*instruments[i]);
+    }
+}
+
 }
@@ -0,0 +1,51 @@
+#include "engines/AnalyticGreeks.hpp"
+
+#include <cmath>
+
+namespace pricer::engines {
+
+pricer::core::Greeks blackScholesGreeks(const pricer::utils::BlackSensitivities& b,
+                                        const pricer::models::BlackScholesModel& model,
+                                        double T)
+{
+    double S     = model.spot();
+    double r     = model.rate();
+    double q     = model.dividendYield();
+    double sigma = model.sigma();
+    double df    = model.discount(T);
+    double F     = model.forward(T);
+    double sqrtT = std::sqrt(T);
+
+    double npv = df * b.value;
+    double dVdF = df * b.dForward;
+
+    pricer::core::Greeks g;
+    g.delta       = dVdF * F / S;
+    g.gamma       = df * b.dForward2 * (F / S) * (F / S);
+    g.vega        = df * b.dStdDev * sqrtT;
+    g.rho         = -T * npv + dVdF * F * T;
+    g.dividendRho = -dVdF * F * T;
+    // theta = -dV/dT : actualisation, dérive du forward, variance restante
+    g.theta       = r * npv - dVdF * F * (r - q) - df * b.dStdDev * sigma / (2.0 * sqrtT);
+    return g;
+}
+
+pricer::core::Greeks blackRatesGreeks(const pricer::utils::BlackSensitivities& b,
+                                      double notional, double A, double dAdr,
+                                      double r, double sigma, double Texp)
+{
+    double weight = notional * A;
+
+    pricer::core::Greeks g;
+    g.delta   = weight * b.dForward;
+    g.gamma   = weight * b.dForward2;
+    g.vega    = weight * b.dStdDev * std::sqrt(Texp);
+    g.rho     = notional * b.value * dAdr;
+    g.annuity = notional * b.value;
+    // le temps qui passe rapproche tous les flux (dA/dt = r A sur une
+    // courbe plate) et réduit la variance jusqu'à l'exercice
+    g.theta   = r * weight * b.value - weight * b.dStdDev * sigma / (2.0 * std::sqrt(Texp));
+    return g;
+}
+
+} 
@@ -0,0 +1,67 @@
+#include "engines/AsianOptionAnalyticEngine.hpp"
+
+#include "products/AsianOption.hpp"
+#include "core/Payoff.hpp"
+#include "utils/AsianFormula.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace pricer::engines {
+
+double AsianOptionAnalyticEngine::priceImpl(const pricer::core::Instrument& inst) const {
+    using pricer::products::AverageType;
+
+    auto const* opt = dynamic_cast<const pricer::products::AsianOption*>(&inst);
+    if (!opt) {
+        throw std::runtime_error("AsianOptionAnalyticEngine: mauvais type d'instrument");
+    }
+
+    auto const* pv = pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(opt->payoff());
+    if (!pv) {
+        throw std::runtime_error("AsianOptionAnalyticEngine: payoff non supporté (non plain vanilla)");
+    }
+
+    double T     = opt->maturity();
+    double S0    = model_->spot();
+    double sigma = model_->sigma();
+    double r     = model_->rate();
+    double q     = model_->dividendYield();
+    double K     = pv->strike();
+
+    std::vector<double> times;
+    if (opt->hasSchedule()) {
+        times = opt->fixingTimes();
+    } else {
+        if (defaultFixings_ == 0) {
+            throw std::runtime_error("AsianOptionAnalyticEngine: defaultFixings nul");
+        }
+        double dt = T / static_cast<double>(defaultFixings_);
+        times.resize(defaultFixings_);
+        for (std::size_t i = 0; i < defaultFixings_; ++i) {
+            times[i] = dt * static_cast<double>(i + 1);
+        }
+    }
+    const auto& past = opt->pastFixings();
+
+    double undiscounted = 0.0;
+    if (opt->averageType() == AverageType::Geometric) {
+        undiscounted = pricer::utils::geometricAsianUndiscounted(S0, K, r, q, sigma, times, pv->type(), past);
+    } else {
+        switch (method_) {
+        case AsianApproximation::TurnbullWakeman:
+            undiscounted = pricer::utils::turnbullWakemanAsianUndiscounted(S0, K, r, q, sigma, times, pv->type(), past);
+            break;
+        case AsianApproximation::Levy:
+            undiscounted = pricer::utils::levyAsianUndiscounted(S0, K, r, q, sigma, times, pv->type(), past);
+            break;
+        case AsianApproximation::Curran:
+            undiscounted = pricer::utils::curranAsianUndiscounted(S0, K, r, q, sigma, times, pv->type(), past);
+            break;
+        }
+    }
+
+    return model_->discount(T) * undiscounted;
+}
+
+} 
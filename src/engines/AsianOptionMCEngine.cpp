@@ -1,14 +1,31 @@
 #include "engines/AsianOptionMCEngine.hpp"
 
 #include "products/AsianOption.hpp"
+#include "core/PayoffKernels.hpp"
+#include "engines/MonteCarloPaths.hpp"
+#include "engines/MonteCarloStatistics.hpp"
+#include "engines/MonteCarloRunner.hpp"
+#include "engines/GbmPathGenerator.hpp"
+#include "engines/MonteCarloGreeks.hpp"
+#include "utils/AsianFormula.hpp"
 
-#include <random>
+#include <chrono>
 #include <cmath>
 #include <stdexcept>
+#include <algorithm>
+#include <optional>
+#include <vector>
 
 namespace pricer::engines {
 
 double AsianOptionMCEngine::priceImpl(const pricer::core::Instrument& inst) const {
+    return resultsImpl(inst).npv;
+}
+
+pricer::core::PricingResults
+AsianOptionMCEngine::resultsImpl(const pricer::core::Instrument& inst) const {
+    auto start = std::chrono::steady_clock::now();
+
     auto const* opt = dynamic_cast<const pricer::products::AsianOption*>(&inst);
     if (!opt) {
         throw std::runtime_error("AsianOptionMCEngine: mauvais type d'instrument");
@@ -18,39 +35,173 @@ double AsianOptionMCEngine::priceImpl(const pricer::core::Instrument& inst) cons
         throw std::runtime_error("AsianOptionMCEngine: nPaths ou nSteps nul");
     }
 
+    using pricer::products::AverageType;
+
     double T      = opt->maturity();
     double S0     = model_->spot();
     double sigma  = model_->sigma();
     double r      = model_->rate();
     double q      = model_->dividendYield();
+    double df     = model_->discount(T);
 
-    double dt     = T / static_cast<double>(nSteps_);
-    double drift  = (r - q - 0.5 * sigma * sigma) * dt;
-    double volDt  = sigma * std::sqrt(dt);
-
-    std::mt19937_64 gen(seed_);
-    std::normal_distribution<> norm(0.0, 1.0);
+    // Dates simulées : fixings futurs du calendrier, ou grille uniforme
+    // de nSteps pas sur ]0, T]
+    bool uniform = !opt->hasSchedule();
+    double dt    = T / static_cast<double>(nSteps_);
+    std::vector<double> times;
+    if (uniform) {
+        times.resize(nSteps_);
+        for (std::size_t i = 0; i < nSteps_; ++i) {
+            times[i] = dt * static_cast<double>(i + 1);
+        }
+    } else {
+        times = opt->fixingTimes();
+    }
+    std::size_t k = times.size();
 
-    double sumPayoff = 0.0;
+    // Fixings déjà constatés : partie fixe de la moyenne
+    bool geometric = (opt->averageType() == AverageType::Geometric);
+    const auto& past = opt->pastFixings();
+    double nFixings = static_cast<double>(k + past.size());
+    double pastSum = 0.0, pastLogSum = 0.0;
+    for (double f : past) {
+        pastSum    += f;
+        pastLogSum += std::log(f);
+    }
+    // G = exp(somme des ln S_i / n) = geoFactor * exp(somme des ln(S_i/S0) / n)
+    double geoFactor = std::exp(pastLogSum / nFixings)
+                     * std::pow(S0, static_cast<double>(k) / nFixings);
 
-    for (std::size_t p = 0; p < nPaths_; ++p) {
-        double S = S0;
-        double sumS = 0.0;
+    bool greeks = settings_.computeGreeks;
 
-        for (std::size_t i = 0; i < nSteps_; ++i) {
-            double z = norm(gen);
-            S *= std::exp(drift + volDt * z);
-            sumS += S;
+    // Tous les fixings constatés : payoff connu
+    if (k == 0) {
+        double avg = geometric ? std::exp(pastLogSum / nFixings) : pastSum / nFixings;
+        pricer::core::PricingResults res;
+        res.npv      = df * opt->payoff()(avg);
+        res.stdError = 0.0;
+        res.paths    = 0;
+        if (greeks) {
+            res.greeks = pricer::core::Greeks{0.0, 0.0, 0.0, -T * res.npv};
         }
+        res.elapsedSeconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        return res;
+    }
 
-        double avgS = sumS / static_cast<double>(nSteps_);
-        double payoff = opt->payoff()(avgS);
-        sumPayoff += payoff;
+    std::vector<double> drift(k), volDt(k);
+    for (std::size_t i = 0; i < k; ++i) {
+        double h = uniform ? dt : times[i] - (i > 0 ? times[i - 1] : 0.0);
+        drift[i] = (r - q - 0.5 * sigma * sigma) * h;
+        volDt[i] = sigma * std::sqrt(h);
+    }
+
+    // Variable de contrôle : payoff sur moyenne géométrique, prix fermé.
+    // Inutile si la moyenne est déjà géométrique (prix exact disponible).
+    const pricer::core::PlainVanillaPayoff* cvPayoff = nullptr;
+    std::optional<double> cvExpectation;
+    if (settings_.controlVariate && !geometric) {
+        cvPayoff = pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(opt->payoff());
+        if (!cvPayoff) {
+            throw std::runtime_error("AsianOptionMCEngine: variable de contrôle réservée aux payoffs vanilles");
+        }
+        cvExpectation = pricer::utils::geometricAsianUndiscounted(
+            S0, cvPayoff->strike(), r, q, sigma, times, cvPayoff->type(), past);
     }
 
-    double meanPayoff = sumPayoff / static_cast<double>(nPaths_);
-    double df = model_->discount(T);
-    return df * meanPayoff;
+    // Grecques : pathwise pour un payoff vanille sur moyenne arithmétique,
+    // rapport de vraisemblance sinon
+    auto const* vanilla = geometric ? nullptr
+                        : pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(opt->payoff());
+
+    // Découpage en blocs indépendant du nombre de threads
+    PathNormals normals(settings_, nPaths_, k, seed_);
+    const auto& blocks = normals.blocks();
+
+    auto simulateBlock = [&](std::size_t b, PathStatistics* stats) {
+        auto stream = normals.stream(b);
+        GbmPathGenerator paths(S0, drift, volDt);
+        PathGreekState greekState = uniform ? PathGreekState(S0, sigma, dt)
+                                            : PathGreekState(S0, sigma, times);
+        GreekSamples greekSamples;
+        std::vector<double> z, sumS, sumLogS, payoffs, cvPayoffs, avgS;
+
+        for (std::size_t first = blocks[b].first; first < blocks[b].last;
+             first += GbmPathGenerator::lockstepPaths) {
+            std::size_t n = std::min(GbmPathGenerator::lockstepPaths, blocks[b].last - first);
+
+            z.resize(k * n);
+            stream.fill(z.data(), n);
+
+            sumS.assign(n, 0.0);
+            sumLogS.assign(n, 0.0);
+            if (greeks) greekState.reset(n);
+            paths.simulate(z.data(), n, [&](std::size_t i, const double* S) {
+                for (std::size_t p = 0; p < n; ++p) {
+                    sumS[p] += S[p];
+                }
+                if (greeks) greekState.step(i, z.data() + i * n, S);
+                if (cvPayoff || geometric) {
+                    // ln S_i = ln S0 + somme des incréments : l'incrément du
+                    // pas i compte dans les (k - i) dates suivantes
+                    double w = static_cast<double>(k - i);
+                    const double* zi = z.data() + i * n;
+                    for (std::size_t p = 0; p < n; ++p) {
+                        sumLogS[p] += w * (drift[i] + volDt[i] * zi[p]);
+                    }
+                }
+            });
+
+            payoffs.resize(n);
+            avgS.resize(n);
+            for (std::size_t p = 0; p < n; ++p) {
+                avgS[p] = geometric ? geoFactor * std::exp(sumLogS[p] / nFixings)
+                                    : (pastSum + sumS[p]) / nFixings;
+            }
+            pricer::core::visitPayoff(opt->payoff(), [&](const auto& payoff) {
+                pricer::core::applyPayoff(payoff, avgS.data(), payoffs.data(), n);
+            });
+
+            if (cvPayoff) {
+                cvPayoffs.resize(n);
+                for (std::size_t p = 0; p < n; ++p) {
+                    double geoS = geoFactor * std::exp(sumLogS[p] / nFixings);
+                    cvPayoffs[p] = (*cvPayoff)(geoS);
+                }
+            }
+
+            addPathSamples(stats[0], payoffs.data(),
+                           cvPayoff ? cvPayoffs.data() : nullptr,
+                           n, settings_.antithetic);
+
+            if (greeks) {
+                if (vanilla) {
+                    greekState.pathwise(*vanilla, avgS.data(), k + past.size(), greekSamples,
+                                        pastSum / nFixings);
+                } else {
+                    greekState.likelihoodRatio(payoffs.data(), greekSamples);
+                }
+                addGreekSamples(stats + 1, greekSamples, n, settings_.antithetic);
+            }
+        }
+    };
+
+    std::size_t nEst = greeks ? greekEstimators : 1;
+    std::vector<std::optional<double>> cvExpectations(nEst);
+    cvExpectations[0] = cvExpectation;
+    auto estimates = runMonteCarlo(normals, settings_, cvExpectations,
+                                   std::vector<double>(nEst, df), simulateBlock, nEst);
+
+    pricer::core::PricingResults res;
+    res.npv            = estimates[0].mean;
+    res.stdError       = estimates[0].stdError;
+    res.paths          = estimates[0].paths;
+    if (greeks) {
+        res.greeks = collectGreeks(estimates, 0, T);
+    }
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
 }
 
 } 
@@ -0,0 +1,112 @@
+#include "engines/BarrierOptionAnalyticEngine.hpp"
+
+#include "products/BarrierOption.hpp"
+#include "core/Payoff.hpp"
+#include "utils/BlackFormula.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace pricer::engines {
+
+double BarrierOptionAnalyticEngine::priceImpl(const pricer::core::Instrument& inst) const {
+    using pricer::core::OptionType;
+    using pricer::products::BarrierType;
+    using pricer::utils::normalCdf;
+
+    auto const* opt = dynamic_cast<const pricer::products::BarrierOption*>(&inst);
+    if (!opt) {
+        throw std::runtime_error("BarrierOptionAnalyticEngine: mauvais type d'instrument");
+    }
+
+    auto const* pv = pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(opt->payoff());
+    if (!pv) {
+        throw std::runtime_error("BarrierOptionAnalyticEngine: payoff non supporté (non plain vanilla)");
+    }
+
+    double T     = opt->maturity();
+    double S     = model_->spot();
+    double sigma = model_->sigma();
+    double r     = model_->rate();
+    double q     = model_->dividendYield();
+    double K     = pv->strike();
+    double H     = opt->barrier();
+    double R     = opt->rebate();
+
+    auto bType = opt->barrierType();
+    bool up  = (bType == BarrierType::UpAndOut || bType == BarrierType::UpAndIn);
+    bool out = (bType == BarrierType::UpAndOut || bType == BarrierType::DownAndOut);
+    bool call = (pv->type() == OptionType::Call);
+
+    double df = model_->discount(T);
+
+    // Barrière déjà franchie : knock-out => rebate immédiat, knock-in => vanille
+    bool breached = up ? (S >= H) : (S <= H);
+    if (breached) {
+        if (out) return R;
+        if (T <= 0.0) return (*pv)(S);
+        return df * pricer::utils::blackForward(model_->forward(T), K, sigma * std::sqrt(T), pv->type());
+    }
+    if (T <= 0.0) {
+        return out ? (*pv)(S) : R;
+    }
+
+    double phi = call ? 1.0 : -1.0;  // call / put
+    double eta = up ? -1.0 : 1.0;    // barrière haute / basse
+
+    double b      = r - q;
+    double vol2   = sigma * sigma;
+    double stdDev = sigma * std::sqrt(T);
+    double mu     = (b - 0.5 * vol2) / vol2;
+
+    double x1 = std::log(S / K) / stdDev + (1.0 + mu) * stdDev;
+    double x2 = std::log(S / H) / stdDev + (1.0 + mu) * stdDev;
+    double y1 = std::log(H * H / (S * K)) / stdDev + (1.0 + mu) * stdDev;
+    double y2 = std::log(H / S) / stdDev + (1.0 + mu) * stdDev;
+
+    double carry = std::exp((b - r) * T);
+    double hs2mu  = std::pow(H / S, 2.0 * mu);
+    double hs2mu1 = hs2mu * (H / S) * (H / S);
+
+    double A = phi * S * carry * normalCdf(phi * x1) - phi * K * df * normalCdf(phi * x1 - phi * stdDev);
+    double B = phi * S * carry * normalCdf(phi * x2) - phi * K * df * normalCdf(phi * x2 - phi * stdDev);
+    double C = phi * S * carry * hs2mu1 * normalCdf(eta * y1)
+             - phi * K * df * hs2mu * normalCdf(eta * y1 - eta * stdDev);
+    double D = phi * S * carry * hs2mu1 * normalCdf(eta * y2)
+             - phi * K * df * hs2mu * normalCdf(eta * y2 - eta * stdDev);
+
+    // Rebates : à maturité si jamais touchée (E), au contact sinon (F)
+    double E = 0.0, F = 0.0;
+    if (R != 0.0) {
+        E = R * df * (normalCdf(eta * x2 - eta * stdDev) - hs2mu * normalCdf(eta * y2 - eta * stdDev));
+    }
+    if (R != 0.0 && out) {
+        // Taux négatif : mu^2 + 2r/sigma^2 peut être négatif, la formule
+        // fermée du rebate au contact n'a alors plus de racine réelle
+        double lambda2 = mu * mu + 2.0 * r / vol2;
+        if (lambda2 < 0.0) {
+            throw std::runtime_error("BarrierOptionAnalyticEngine: rebate au contact non calculable "
+                                     "(mu^2 + 2r/sigma^2 < 0, taux négatif)");
+        }
+        double lambda = std::sqrt(lambda2);
+        double z = std::log(H / S) / stdDev + lambda * stdDev;
+        F = R * (std::pow(H / S, mu + lambda) * normalCdf(eta * z)
+               + std::pow(H / S, mu - lambda) * normalCdf(eta * z - 2.0 * eta * lambda * stdDev));
+    }
+
+    bool strikeAbove = (K > H);
+
+    if (!out) {
+        if (call && !up) return (strikeAbove ? C : A - B + D) + E;          // down-and-in call
+        if (call &&  up) return (strikeAbove ? A : B - C + D) + E;          // up-and-in call
+        if (!call && !up) return (strikeAbove ? B - C + D : A) + E;         // down-and-in put
+        return (strikeAbove ? A - B + D : C) + E;                           // up-and-in put
+    }
+
+    if (call && !up) return (strikeAbove ? A - C : B - D) + F;              // down-and-out call
+    if (call &&  up) return (strikeAbove ? 0.0 : A - B + C - D) + F;        // up-and-out call
+    if (!call && !up) return (strikeAbove ? A - B + C - D : 0.0) + F;       // down-and-out put
+    return (strikeAbove ? B - D : A - C) + F;                               // up-and-out put
+}
+
+} 
@@ -1,14 +1,31 @@
 #include "engines/BarrierOptionMCEngine.hpp"
 
 #include "products/BarrierOption.hpp"
+#include "core/PayoffKernels.hpp"
+#include "engines/MonteCarloPaths.hpp"
+#include "engines/MonteCarloStatistics.hpp"
+#include "engines/MonteCarloRunner.hpp"
+#include "engines/GbmPathGenerator.hpp"
+#include "engines/MonteCarloGreeks.hpp"
+#include "utils/VectorMath.hpp"
 
-#include <random>
+#include <chrono>
 #include <cmath>
 #include <stdexcept>
+#include <algorithm>
+#include <optional>
+#include <vector>
 
 namespace pricer::engines {
 
 double BarrierOptionMCEngine::priceImpl(const pricer::core::Instrument& inst) const {
+    return resultsImpl(inst).npv;
+}
+
+pricer::core::PricingResults
+BarrierOptionMCEngine::resultsImpl(const pricer::core::Instrument& inst) const {
+    auto start = std::chrono::steady_clock::now();
+
     auto const* opt = dynamic_cast<const pricer::products::BarrierOption*>(&inst);
     if (!opt) {
         throw std::runtime_error("BarrierOptionMCEngine: mauvais type d'instrument");
@@ -31,51 +48,218 @@ double BarrierOptionMCEngine::priceImpl(const pricer::core::Instrument& inst) co
     double B      = opt->barrier();
     auto   bType  = opt->barrierType();
 
-    std::mt19937_64 gen(seed_);
-    std::normal_distribution<> norm(0.0, 1.0);
+    // Découpage en blocs indépendant du nombre de threads
+    PathNormals normals(settings_, nPaths_, nSteps_, seed_);
+    const auto& blocks = normals.blocks();
+
+    using pricer::products::BarrierType;
+    bool up  = (bType == BarrierType::UpAndOut || bType == BarrierType::UpAndIn);
+    bool out = (bType == BarrierType::UpAndOut || bType == BarrierType::DownAndOut);
+
+    // Surveillance continue : entre deux dates, le log-spot est un pont
+    // brownien ; avec x = ln(S/B) du même côté de la barrière aux deux
+    // bornes, P(franchissement) = exp(-2 x_{i-1} x_i / (sigma^2 dt)).
+    bool continuous = (settings_.barrierMonitoring == BarrierMonitoring::Continuous);
+    double bridgeScale = -2.0 / (sigma * sigma * dt);
+    double x0 = std::log(S0 / B);
+
+    double df = model_->discount(T);
+
+    // Rebate d'un knock-out, payé à la date de contact : pour un contact au
+    // pas i, R * D(t_i) / D(T) en unités du payoff (actualisé ensuite par D(T)).
+    // Sa dérivée par rapport au taux donne un terme explicite du rho.
+    double R = opt->rebate();
+    bool rebateOut = out && R != 0.0;
+    std::vector<double> rebateGrowth(nSteps_), rebateRhoWeight(nSteps_);
+    for (std::size_t i = 0; i < nSteps_; ++i) {
+        double t = dt * static_cast<double>(i + 1);
+        rebateGrowth[i]    = R * model_->discount(t) / df;
+        rebateRhoWeight[i] = (T - t) * rebateGrowth[i];
+    }
 
-    double sumPayoff = 0.0;
+    // Grecques par rapport de vraisemblance (payoff discontinu). En mode
+    // continu, le poids de survie dépend aussi explicitement de S0 (premier
+    // intervalle) et de sigma : ces dérivées, à chemin fixé, s'ajoutent.
+    bool greeks = settings_.computeGreeks;
 
-    for (std::size_t p = 0; p < nPaths_; ++p) {
-        double S = S0;
-        bool hit = false;
+    auto simulateBlock = [&](std::size_t b, PathStatistics* stats) {
+        auto stream = normals.stream(b);
+        GbmPathGenerator paths(S0, drift, volDt, nSteps_);
+        PathGreekState greekState(S0, sigma, dt);
+        GreekSamples greekSamples;
+        std::vector<double> z, payoffs, terminal;
+        std::vector<unsigned char> hit;
+        std::vector<double> x, crossing, survival;
+        std::vector<double> exponent, dLogSurvS0, d2LogSurvS0, dLogSurvSigma;
+        std::vector<double> rebate, rebateVega, rebateRho;
 
-        for (std::size_t i = 0; i < nSteps_; ++i) {
-            double z = norm(gen);
-            S *= std::exp(drift + volDt * z);
+        for (std::size_t first = blocks[b].first; first < blocks[b].last;
+             first += GbmPathGenerator::lockstepPaths) {
+            std::size_t n = std::min(GbmPathGenerator::lockstepPaths, blocks[b].last - first);
 
-            switch (bType) {
-                case pricer::products::BarrierType::UpAndOut:
-                case pricer::products::BarrierType::UpAndIn:
-                    if (S >= B) hit = true;
-                    break;
-                case pricer::products::BarrierType::DownAndOut:
-                case pricer::products::BarrierType::DownAndIn:
-                    if (S <= B) hit = true;
-                    break;
+            z.resize(nSteps_ * n);
+            stream.fill(z.data(), n);
+
+            if (greeks) greekState.reset(n);
+            if (rebateOut) {
+                rebate.assign(n, 0.0);
+                rebateVega.assign(n, 0.0);
+                rebateRho.assign(n, 0.0);
             }
-        }
 
-        double payoff = 0.0;
-
-        using pricer::products::BarrierType;
-        switch (bType) {
-            case BarrierType::UpAndOut:
-            case BarrierType::DownAndOut:
-                payoff = hit ? 0.0 : opt->payoff()(S);
-                break;
-            case BarrierType::UpAndIn:
-            case BarrierType::DownAndIn:
-                payoff = hit ? opt->payoff()(S) : 0.0;
-                break;
+            if (continuous) {
+                x.assign(n, x0);
+                crossing.resize(n);
+                survival.assign(n, 1.0);
+                if (greeks) {
+                    exponent.resize(n);
+                    dLogSurvS0.assign(n, 0.0);
+                    d2LogSurvS0.assign(n, 0.0);
+                    dLogSurvSigma.assign(n, 0.0);
+                }
+
+                paths.simulate(z.data(), n, [&](std::size_t i, const double* S) {
+                    const double* zi = z.data() + i * n;
+                    for (std::size_t p = 0; p < n; ++p) {
+                        double xPrev = x[p];
+                        double xNext = xPrev + drift + volDt * zi[p];
+                        bool safe = up ? (xPrev < 0.0 && xNext < 0.0)
+                                       : (xPrev > 0.0 && xNext > 0.0);
+                        // hors zone sûre : exposant nul, franchissement certain
+                        crossing[p] = safe ? bridgeScale * xPrev * xNext : 0.0;
+                        x[p] = xNext;
+                    }
+                    if (greeks) {
+                        std::copy(crossing.begin(), crossing.end(), exponent.begin());
+                    }
+                    pricer::utils::vexp(crossing.data(), crossing.data(), n);
+                    if (greeks) greekState.step(i, zi, S);
+
+                    for (std::size_t p = 0; p < n; ++p) {
+                        double pc    = crossing[p];
+                        double sPrev = survival[p];
+                        double sNew  = sPrev * (1.0 - pc);
+                        survival[p]  = sNew;
+                        if (rebateOut) rebate[p] += rebateGrowth[i] * (sPrev - sNew);
+                        if (!greeks) continue;
+
+                        // Dérivées de ln(1 - p), p = exp(c x_{i-1} x_i) ; négligées
+                        // quand la survie est déjà nulle à 1e-12 près
+                        double bPrev = dLogSurvSigma[p];
+                        double surv  = 1.0 - pc;
+                        if (exponent[p] != 0.0 && surv > 1e-12) {
+                            dLogSurvSigma[p] += 2.0 * pc * exponent[p] / (sigma * surv);
+                            if (i == 0) {
+                                double cx = bridgeScale * x[p];
+                                double a  = -cx * pc / (surv * S0);
+                                dLogSurvS0[p]  = a;
+                                d2LogSurvS0[p] = a / S0 * (cx / surv - 1.0);
+                            }
+                        }
+                        if (rebateOut) {
+                            rebateVega[p] += rebateGrowth[i] * (sPrev * bPrev - sNew * dLogSurvSigma[p]);
+                            rebateRho[p]  += rebateRhoWeight[i] * (sPrev - sNew);
+                        }
+                    }
+                });
+
+                const double* ST = paths.spots();
+                payoffs.resize(n);
+                terminal.resize(n);
+                pricer::core::visitPayoff(opt->payoff(), [&](const auto& payoff) {
+                    pricer::core::applyPayoff(payoff, ST, terminal.data(), n);
+                });
+                for (std::size_t p = 0; p < n; ++p) {
+                    double f = terminal[p];
+                    payoffs[p] = out ? survival[p] * f + (rebateOut ? rebate[p] : 0.0)
+                                     : (1.0 - survival[p]) * f + survival[p] * R;
+                }
+
+                if (greeks) {
+                    greekState.likelihoodRatio(payoffs.data(), greekSamples);
+                    const double* z1 = greekState.z1();
+                    for (std::size_t p = 0; p < n; ++p) {
+                        // Seul le premier intervalle dépend de S0 : chaque terme
+                        // en s_i est proportionnel à son premier facteur
+                        double f  = terminal[p];
+                        double s  = survival[p];
+                        double fs = out ? payoffs[p] - (rebateOut ? rebateGrowth[0] : 0.0)
+                                        : (R - f) * s;
+                        double vegaExplicit = out ? f * s * dLogSurvSigma[p]
+                                                  : (R - f) * s * dLogSurvSigma[p];
+                        double a  = dLogSurvS0[p];
+                        double scoreS0 = z1[p] / (S0 * volDt);
+                        greekSamples.delta[p] += fs * a;
+                        greekSamples.gamma[p] += 2.0 * fs * a * scoreS0
+                                               + fs * (a * a + d2LogSurvS0[p]);
+                        greekSamples.vega[p]  += vegaExplicit;
+                        if (rebateOut) {
+                            greekSamples.vega[p] += rebateVega[p];
+                            greekSamples.rho[p]  += rebateRho[p];
+                        }
+                    }
+                }
+            } else {
+                hit.assign(n, 0);
+                paths.simulate(z.data(), n, [&](std::size_t i, const double* S) {
+                    if (greeks) greekState.step(i, z.data() + i * n, S);
+                    if (rebateOut) {
+                        // date du premier contact nécessaire pour le rebate
+                        for (std::size_t p = 0; p < n; ++p) {
+                            bool crossed = up ? (S[p] >= B) : (S[p] <= B);
+                            if (crossed && !hit[p]) {
+                                hit[p] = 1;
+                                rebate[p]    = rebateGrowth[i];
+                                rebateRho[p] = rebateRhoWeight[i];
+                            }
+                        }
+                    } else if (up) {
+                        for (std::size_t p = 0; p < n; ++p) hit[p] |= (S[p] >= B);
+                    } else {
+                        for (std::size_t p = 0; p < n; ++p) hit[p] |= (S[p] <= B);
+                    }
+                });
+
+                const double* ST = paths.spots();
+                payoffs.resize(n);
+                pricer::core::visitPayoff(opt->payoff(), [&](const auto& payoff) {
+                    for (std::size_t p = 0; p < n; ++p) {
+                        bool alive = out ? !hit[p] : hit[p];
+                        double dead = out ? (rebateOut ? rebate[p] : 0.0) : R;
+                        payoffs[p] = alive ? payoff(ST[p]) : dead;
+                    }
+                });
+
+                if (greeks) {
+                    greekState.likelihoodRatio(payoffs.data(), greekSamples);
+                    if (rebateOut) {
+                        for (std::size_t p = 0; p < n; ++p) greekSamples.rho[p] += rebateRho[p];
+                    }
+                }
+            }
+
+            addPathSamples(stats[0], payoffs.data(), nullptr, n, settings_.antithetic);
+            if (greeks) {
+                addGreekSamples(stats + 1, greekSamples, n, settings_.antithetic);
+            }
         }
+    };
 
-        sumPayoff += payoff;
-    }
+    std::size_t nEst = greeks ? greekEstimators : 1;
+    auto estimates = runMonteCarlo(normals, settings_,
+                                   std::vector<std::optional<double>>(nEst),
+                                   std::vector<double>(nEst, df), simulateBlock, nEst);
 
-    double meanPayoff = sumPayoff / static_cast<double>(nPaths_);
-    double df = model_->discount(T);
-    return df * meanPayoff;
+    pricer::core::PricingResults res;
+    res.npv            = estimates[0].mean;
+    res.stdError       = estimates[0].stdError;
+    res.paths          = estimates[0].paths;
+    if (greeks) {
+        res.greeks = collectGreeks(estimates, 0, T);
+    }
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
 }
 
 } 
@@ -3,12 +3,97 @@
 #include "products/CapFloor.hpp"
 #include "core/Payoff.hpp"
 #include "utils/BlackFormula.hpp"
+#include "engines/AnalyticGreeks.hpp"
 
+#include <chrono>
 #include <cmath>
+#include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 namespace pricer::engines {
 
+namespace {
+
+// Prix Black de caplets (ou floorlets) en un seul appel en lot ; le poids
+// notionnel * fraction d'année * DF(fin) tient lieu d'actualisation
+void priceCapletsBlack(const std::vector<const pricer::products::Caplet*>& caplets,
+                       const pricer::models::BlackIRModel& model,
+                       std::vector<double>& prices)
+{
+    std::size_t n = caplets.size();
+    std::vector<double> F(n), K(n), stdDev(n), weight(n);
+    std::vector<pricer::core::OptionType> types(n);
+    prices.resize(n);
+
+    double sigma = model.sigma();
+    std::vector<double> ends(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto& c = *caplets[i];
+        F[i]      = c.forwardRate();
+        K[i]      = c.strike();
+        stdDev[i] = sigma * std::sqrt(c.start());
+        types[i]  = c.type();
+        ends[i]   = c.end();
+    }
+
+    // DF(fin) demandés au modèle en un appel
+    model.discount(ends, weight);
+    for (std::size_t i = 0; i < n; ++i) {
+        weight[i] *= caplets[i]->notional() * caplets[i]->yearFraction();
+    }
+
+    pricer::utils::blackForwardBatch(F, K, stdDev, types, weight, prices);
+}
+
+template <class Period>
+double sumCapletsBlack(const std::vector<Period>& periods,
+                       const pricer::models::BlackIRModel& model)
+{
+    std::vector<const pricer::products::Caplet*> caplets;
+    caplets.reserve(periods.size());
+    for (const auto& p : periods) caplets.push_back(&p);
+
+    std::vector<double> prices;
+    priceCapletsBlack(caplets, model, prices);
+
+    double total = 0.0;
+    for (double p : prices) total += p;
+    return total;
+}
+
+// Lot de caps (ou de floors) : toutes les périodes du lot passent dans un
+// seul appel Black, puis sont sommées produit par produit
+template <class Product, class Periods>
+void sumCapletsBlackBatch(pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+                          pricer::utils::Span<double> out,
+                          const pricer::models::BlackIRModel& model,
+                          Periods periodsOf,
+                          const char* error)
+{
+    std::vector<const pricer::products::Caplet*> caplets;
+    std::vector<std::size_t> offsets{0};
+    offsets.reserve(instruments.size() + 1);
+    for (const auto* inst : instruments) {
+        auto const* product = pricer::core::instrumentAs<Product>(*inst);
+        if (!product) {
+            throw std::runtime_error(error);
+        }
+        for (const auto& p : periodsOf(*product)) caplets.push_back(&p);
+        offsets.push_back(caplets.size());
+    }
+
+    std::vector<double> prices;
+    priceCapletsBlack(caplets, model, prices);
+
+    for (std::size_t i = 0; i < instruments.size(); ++i) {
+        double total = 0.0;
+        for (std::size_t j = offsets[i]; j < offsets[i + 1]; ++j) total += prices[j];
+        out[i] = total;
+    }
+}
+
+} 
 
 
 double CapletBlackEngine::priceImpl(const pricer::core::Instrument& inst) const {
@@ -33,57 +118,110 @@ double CapletBlackEngine::priceImpl(const pricer::core::Instrument& inst) const
 }
 
 
-double CapBlackEngine::priceImpl(const pricer::core::Instrument& inst) const {
-    auto const* cap = dynamic_cast<const pricer::products::Cap*>(&inst);
-    if (!cap) {
-        throw std::runtime_error("CapBlackEngine: mauvais type d'instrument");
+pricer::core::PricingResults
+CapletBlackEngine::resultsImpl(const pricer::core::Instrument& inst) const {
+    auto const* caplet = dynamic_cast<const pricer::products::Caplet*>(&inst);
+    if (!caplet) {
+        throw std::runtime_error("CapletBlackEngine: mauvais type d'instrument");
     }
 
-    double total = 0.0;
+    double Toption = caplet->start();
+    if (Toption <= 0.0) {
+        return PricingEngine::resultsImpl(inst);
+    }
 
-    for (const auto& c : cap->caplets()) {
-        double Toption = c.start();
-        double Tend    = c.end();
-        double F       = c.forwardRate();
-        double K       = c.strike();
-        double sigma   = model_->sigma();
-        double df      = model_->discount(Tend);
+    auto start = std::chrono::steady_clock::now();
 
-        double stdDev = sigma * std::sqrt(Toption);
-        double black  = pricer::utils::blackForward(F, K, stdDev, c.type());
+    double Tend  = caplet->end();
+    double sigma = model_->sigma();
+    double A     = caplet->yearFraction() * model_->discount(Tend);
 
-        total += c.notional() * c.yearFraction() * df * black;
+    auto b = pricer::utils::blackForwardSensitivities(
+        caplet->forwardRate(), caplet->strike(), sigma * std::sqrt(Toption), caplet->type());
 
+    pricer::core::PricingResults res;
+    res.npv = caplet->notional() * A * b.value;
+    res.greeks = blackRatesGreeks(b, caplet->notional(), A, -Tend * A,
+                                  model_->rate(), sigma, Toption);
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+
+void CapletBlackEngine::batchImpl(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<double> out) const
+{
+    std::vector<const pricer::products::Caplet*> caplets;
+    caplets.reserve(instruments.size());
+    for (const auto* inst : instruments) {
+        auto const* caplet = pricer::core::instrumentAs<pricer::products::Caplet>(*inst);
+        if (!caplet) {
+            throw std::runtime_error("CapletBlackEngine: mauvais type d'instrument");
+        }
+        caplets.push_back(caplet);
     }
 
-    return total;
+    std::vector<double> prices;
+    priceCapletsBlack(caplets, *model_, prices);
+    std::copy(prices.begin(), prices.end(), out.begin());
 }
 
 
-double FloorBlackEngine::priceImpl(const pricer::core::Instrument& inst) const {
-    auto const* floor = dynamic_cast<const pricer::products::Floor*>(&inst);
-    if (!floor) {
-        throw std::runtime_error("FloorBlackEngine: mauvais type d'instrument");
+double CapletBlackEngine::impliedVolatility(const pricer::products::Caplet& caplet,
+                                            double price) const
+{
+    double Toption = caplet.start();
+    if (Toption <= 0.0) {
+        throw std::runtime_error("CapletBlackEngine: volatilité implicite d'un caplet déjà fixé");
     }
 
-    double total = 0.0;
+    double weight = caplet.notional() * caplet.yearFraction() * model_->discount(caplet.end());
+    double stdDev = pricer::utils::impliedBlackStdDev(
+        price / weight, caplet.forwardRate(), caplet.strike(), caplet.type());
 
-    for (const auto& f : floor->floorlets()) {
-        double Toption = f.start();
-        double Tend    = f.end();
-        double F       = f.forwardRate();
-        double K       = f.strike();
-        double sigma   = model_->sigma();
-        double df      = model_->discount(Tend);
+    return stdDev / std::sqrt(Toption);
+}
 
-        double stdDev = sigma * std::sqrt(Toption);
-        double black  = pricer::utils::blackForward(F, K, stdDev, f.type());
 
-        total += f.notional() * f.yearFraction() * df * black;
+double CapBlackEngine::priceImpl(const pricer::core::Instrument& inst) const {
+    auto const* cap = dynamic_cast<const pricer::products::Cap*>(&inst);
+    if (!cap) {
+        throw std::runtime_error("CapBlackEngine: mauvais type d'instrument");
+    }
+
+    return sumCapletsBlack(cap->caplets(), *model_);
+}
+
 
+double FloorBlackEngine::priceImpl(const pricer::core::Instrument& inst) const {
+    auto const* floor = dynamic_cast<const pricer::products::Floor*>(&inst);
+    if (!floor) {
+        throw std::runtime_error("FloorBlackEngine: mauvais type d'instrument");
     }
 
-    return total;
+    return sumCapletsBlack(floor->floorlets(), *model_);
+}
+
+void CapBlackEngine::batchImpl(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<double> out) const
+{
+    sumCapletsBlackBatch<pricer::products::Cap>(
+        instruments, out, *model_,
+        [](const pricer::products::Cap& cap) -> const auto& { return cap.caplets(); },
+        "CapBlackEngine: mauvais type d'instrument");
+}
+
+void FloorBlackEngine::batchImpl(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<double> out) const
+{
+    sumCapletsBlackBatch<pricer::products::Floor>(
+        instruments, out, *model_,
+        [](const pricer::products::Floor& floor) -> const auto& { return floor.floorlets(); },
+        "FloorBlackEngine: mauvais type d'instrument");
 }
 
 } 
@@ -3,9 +3,12 @@
 #include "products/DigitalOption.hpp"
 #include "core/Payoff.hpp"
 #include "utils/BlackFormula.hpp"
+#include "engines/AnalyticGreeks.hpp"
 
+#include <chrono>
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 namespace pricer::engines {
 
@@ -32,7 +35,7 @@ double DigitalOptionBSEngine::priceImpl(const pricer::core::Instrument& inst) co
         return df * opt->payoff()(F);
     }
 
-    auto const* dp = dynamic_cast<const pricer::core::DigitalPayoff*>(&(opt->payoff()));
+    auto const* dp = pricer::core::payoffAs<pricer::core::DigitalPayoff>(opt->payoff());
     if (!dp) {
         throw std::runtime_error("DigitalOptionBSEngine: payoff non DigitalPayoff");
     }
@@ -46,5 +49,78 @@ double DigitalOptionBSEngine::priceImpl(const pricer::core::Instrument& inst) co
     return price;
 }
 
+pricer::core::PricingResults
+DigitalOptionBSEngine::resultsImpl(const pricer::core::Instrument& inst) const {
+    auto const* opt = dynamic_cast<const pricer::products::DigitalOption*>(&inst);
+    if (!opt) {
+        throw std::runtime_error("DigitalOptionBSEngine: mauvais type d'instrument");
+    }
+    auto const* dp = pricer::core::payoffAs<pricer::core::DigitalPayoff>(opt->payoff());
+    if (!dp) {
+        return PricingEngine::resultsImpl(inst);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    double T = opt->maturity();
+
+    pricer::core::PricingResults res;
+    if (T <= 0.0) {
+        res.npv = opt->payoff()(model_->spot());
+        res.greeks = pricer::core::Greeks{};
+    } else {
+        double stdDev = model_->sigma() * std::sqrt(T);
+        auto b = pricer::utils::blackDigitalForwardSensitivities(
+            model_->forward(T), dp->strike(), stdDev, dp->type(), dp->payout());
+        res.npv = model_->discount(T) * b.value;
+        res.greeks = blackScholesGreeks(b, *model_, T);
+    }
+
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+void DigitalOptionBSEngine::batchImpl(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<double> out) const
+{
+    double sigma = model_->sigma();
+
+    // Digitales non échues : forwards et actualisations demandés au modèle
+    // en un appel chacun ; les autres cas passent par priceImpl
+    std::size_t n = instruments.size();
+    std::vector<const pricer::products::DigitalOption*> live;
+    std::vector<double> T, F, df;
+    std::vector<std::size_t> index;
+    live.reserve(n); T.reserve(n); index.reserve(n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const* opt = pricer::core::instrumentAs<pricer::products::DigitalOption>(*instruments[i]);
+        if (!opt) {
+            throw std::runtime_error("DigitalOptionBSEngine: mauvais type d'instrument");
+        }
+        auto const* dp = pricer::core::payoffAs<pricer::core::DigitalPayoff>(opt->payoff());
+        if (!dp || opt->maturity() <= 0.0) {
+            out[i] = priceImpl(*opt);
+            continue;
+        }
+        live.push_back(opt);
+        T.push_back(opt->maturity());
+        index.push_back(i);
+    }
+
+    std::size_t m = index.size();
+    F.resize(m);
+    df.resize(m);
+    model_->forward(T, F);
+    model_->discount(T, df);
+    for (std::size_t j = 0; j < m; ++j) {
+        const auto& dp = static_cast<const pricer::core::DigitalPayoff&>(live[j]->payoff());
+        out[index[j]] = df[j]
+                      * pricer::utils::blackDigitalForward(F[j], dp.strike(), sigma * std::sqrt(T[j]),
+                                                           dp.type(), dp.payout());
+    }
+}
 
 } 
@@ -3,9 +3,12 @@
 #include "products/EuropeanOption.hpp"
 #include "core/Payoff.hpp"
 #include "utils/BlackFormula.hpp"
+#include "engines/AnalyticGreeks.hpp"
 
+#include <chrono>
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 namespace pricer::engines {
 
@@ -41,7 +44,7 @@ double EuropeanOptionBSEngine::priceImpl(const pricer::core::Instrument& inst) c
         return df * payoffForward;
     }
 
-    auto const* pv = dynamic_cast<const pricer::core::PlainVanillaPayoff*>(&(opt->payoff()));
+    auto const* pv = pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(opt->payoff());
     if (!pv) {
         throw std::runtime_error("EuropeanOptionBSEngine: payoff non supporté (non plain vanilla)");
     }
@@ -55,5 +58,87 @@ double EuropeanOptionBSEngine::priceImpl(const pricer::core::Instrument& inst) c
     return price;
 }
 
+pricer::core::PricingResults
+EuropeanOptionBSEngine::resultsImpl(const pricer::core::Instrument& inst) const {
+    auto const* opt = dynamic_cast<const pricer::products::EuropeanOption*>(&inst);
+    if (!opt) {
+        throw std::runtime_error("EuropeanOptionBSEngine: mauvais type d'instrument");
+    }
+    auto const* pv = pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(opt->payoff());
+    if (!pv) {
+        return PricingEngine::resultsImpl(inst);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    double T  = opt->maturity();
+    double S0 = model_->spot();
+
+    pricer::core::PricingResults res;
+    if (T <= 0.0) {
+        // À maturité : payoff sur le spot, seul le delta subsiste
+        auto b = pricer::utils::blackForwardSensitivities(S0, pv->strike(), 0.0, pv->type());
+        res.npv = b.value;
+        res.greeks = pricer::core::Greeks{};
+        res.greeks->delta = b.dForward;
+    } else {
+        double stdDev = model_->sigma() * std::sqrt(T);
+        auto b = pricer::utils::blackForwardSensitivities(
+            model_->forward(T), pv->strike(), stdDev, pv->type());
+        res.npv = model_->discount(T) * b.value;
+        res.greeks = blackScholesGreeks(b, *model_, T);
+    }
+
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+void EuropeanOptionBSEngine::batchImpl(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<double> out) const
+{
+    double sigma = model_->sigma();
+
+    // Options vanille non échues rangées en tableaux ; les autres cas
+    // passent par priceImpl
+    std::size_t n = instruments.size();
+    std::vector<double> T, F, K, stdDev, df, prices;
+    std::vector<pricer::core::OptionType> types;
+    std::vector<std::size_t> index;
+    T.reserve(n); K.reserve(n); stdDev.reserve(n);
+    types.reserve(n); index.reserve(n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const* opt = pricer::core::instrumentAs<pricer::products::EuropeanOption>(*instruments[i]);
+        if (!opt) {
+            throw std::runtime_error("EuropeanOptionBSEngine: mauvais type d'instrument");
+        }
+        auto const* pv = pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(opt->payoff());
+        double maturity = opt->maturity();
+        if (!pv || maturity <= 0.0) {
+            out[i] = priceImpl(*opt);
+            continue;
+        }
+        T.push_back(maturity);
+        stdDev.push_back(sigma * std::sqrt(maturity));
+        K.push_back(pv->strike());
+        types.push_back(pv->type());
+        index.push_back(i);
+    }
+
+    // Forwards et actualisations demandés au modèle en un appel chacun
+    std::size_t m = index.size();
+    F.resize(m);
+    df.resize(m);
+    model_->forward(T, F);
+    model_->discount(T, df);
+
+    prices.resize(m);
+    pricer::utils::blackForwardBatch(F, K, stdDev, types, df, prices);
+    for (std::size_t j = 0; j < m; ++j) {
+        out[index[j]] = prices[j];
+    }
+}
 
 } 
@@ -0,0 +1,44 @@
+#include "engines/GbmPathGenerator.hpp"
+
+#include "utils/VectorMath.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace pricer::engines {
+
+GbmPathGenerator::GbmPathGenerator(double S0, double drift, double volDt,
+                                   std::size_t nSteps)
+    : S0_(S0),
+      drift_(nSteps, drift),
+      volDt_(nSteps, volDt),
+      nSteps_(nSteps) {}
+
+GbmPathGenerator::GbmPathGenerator(double S0, std::vector<double> drift,
+                                   std::vector<double> volDt)
+    : S0_(S0),
+      drift_(std::move(drift)),
+      volDt_(std::move(volDt)),
+      nSteps_(drift_.size())
+{
+    if (volDt_.size() != nSteps_) {
+        throw std::runtime_error("GbmPathGenerator: tailles de dérive et de volatilité différentes");
+    }
+}
+
+void GbmPathGenerator::advance(std::size_t i, const double* z, std::size_t n) {
+    double* w = work_.data();
+    double* S = spot_.data();
+    double drift = drift_[i];
+    double volDt = volDt_[i];
+
+    for (std::size_t p = 0; p < n; ++p) {
+        w[p] = drift + volDt * z[p];
+    }
+    pricer::utils::vexp(w, w, n);
+    for (std::size_t p = 0; p < n; ++p) {
+        S[p] *= w[p];
+    }
+}
+
+} 
@@ -0,0 +1,116 @@
+#include "engines/MonteCarloGreeks.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace pricer::engines {
+
+void addGreekSamples(PathStatistics* stats, const GreekSamples& samples,
+                     std::size_t n, bool antithetic)
+{
+    addPathSamples(stats[0], samples.delta.data(), nullptr, n, antithetic);
+    addPathSamples(stats[1], samples.gamma.data(), nullptr, n, antithetic);
+    addPathSamples(stats[2], samples.vega.data(),  nullptr, n, antithetic);
+    addPathSamples(stats[3], samples.rho.data(),   nullptr, n, antithetic);
+}
+
+PathGreekState::PathGreekState(double S0, double sigma, std::vector<double> times)
+    : S0_(S0), sigma_(sigma), times_(std::move(times))
+{
+    if (times_.empty() || times_[0] <= 0.0) {
+        throw std::runtime_error("PathGreekState: grille de dates vide ou non positive");
+    }
+    sqrtDts_.resize(times_.size());
+    for (std::size_t i = 0; i < times_.size(); ++i) {
+        sqrtDts_[i] = std::sqrt(times_[i] - (i > 0 ? times_[i - 1] : 0.0));
+    }
+    dt_     = times_[0];
+    sqrtDt_ = sqrtDts_[0];
+}
+
+void PathGreekState::reset(std::size_t n) {
+    n_ = n;
+    steps_ = 0;
+    z1_.assign(n, 0.0);
+    W_.assign(n, 0.0);
+    sumZ2_.assign(n, 0.0);
+    sumSW_.assign(n, 0.0);
+    sumTS_.assign(n, 0.0);
+}
+
+void PathGreekState::step(std::size_t i, const double* zi, const double* S) {
+    bool uniform  = times_.empty();
+    double t      = uniform ? dt_ * static_cast<double>(i + 1) : times_[i];
+    double sqrtDt = uniform ? sqrtDt_ : sqrtDts_[i];
+    if (i == 0) {
+        std::copy(zi, zi + n_, z1_.begin());
+    }
+    for (std::size_t p = 0; p < n_; ++p) {
+        W_[p]     += sqrtDt * zi[p];
+        sumZ2_[p] += zi[p] * zi[p];
+        sumSW_[p] += S[p] * (W_[p] - sigma_ * t);
+        sumTS_[p] += t * S[p];
+    }
+    steps_ = i + 1;
+}
+
+void PathGreekState::pathwise(const pricer::core::PlainVanillaPayoff& payoff,
+                              const double* avg, std::size_t m,
+                              GreekSamples& out, double fixedPart) const
+{
+    using pricer::core::OptionType;
+
+    double K = payoff.strike();
+    bool call = (payoff.type() == OptionType::Call);
+    double invM = 1.0 / static_cast<double>(m);
+    double sigmaSqrtDt = sigma_ * sqrtDt_;
+
+    out.resize(n_);
+    for (std::size_t p = 0; p < n_; ++p) {
+        double slope = call ? (avg[p] > K ? 1.0 : 0.0)
+                            : (avg[p] < K ? -1.0 : 0.0);
+        double delta = slope * (avg[p] - fixedPart) / S0_;
+        out.delta[p] = delta;
+        // gamma : delta pathwise dérivé par rapport de vraisemblance sur le
+        // premier pas (la pente du payoff n'est pas dérivable)
+        out.gamma[p] = delta * (z1_[p] / sigmaSqrtDt - 1.0) / S0_;
+        out.vega[p]  = slope * sumSW_[p] * invM;
+        out.rho[p]   = slope * sumTS_[p] * invM;
+    }
+}
+
+void PathGreekState::likelihoodRatio(const double* X, GreekSamples& out) const {
+    double sigmaSqrtDt = sigma_ * sqrtDt_;
+    double varDt = sigma_ * sigma_ * dt_;
+    double S02 = S0_ * S0_;
+    double steps = static_cast<double>(steps_);
+
+    out.resize(n_);
+    for (std::size_t p = 0; p < n_; ++p) {
+        double z1 = z1_[p];
+        // Scores de la densité des log-incréments N(mu dt, sigma^2 dt)
+        double scoreS0    = z1 / (S0_ * sigmaSqrtDt);
+        double scoreS0S0  = (z1 * z1 - 1.0) / (S02 * varDt) - z1 / (S02 * sigmaSqrtDt);
+        double scoreSigma = (sumZ2_[p] - steps) / sigma_ - W_[p];
+        double scoreRate  = W_[p] / sigma_;
+
+        out.delta[p] = X[p] * scoreS0;
+        out.gamma[p] = X[p] * scoreS0S0;
+        out.vega[p]  = X[p] * scoreSigma;
+        out.rho[p]   = X[p] * scoreRate;
+    }
+}
+
+pricer::core::Greeks collectGreeks(const std::vector<MonteCarloEstimate>& est,
+                                   std::size_t offset, double T)
+{
+    pricer::core::Greeks g;
+    g.delta = est[offset + 1].mean;
+    g.gamma = est[offset + 2].mean;
+    g.vega  = est[offset + 3].mean;
+    g.rho   = est[offset + 4].mean - T * est[offset].mean;
+    return g;
+}
+
+} 
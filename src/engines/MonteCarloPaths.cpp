@@ -0,0 +1,148 @@
+#include "engines/MonteCarloPaths.hpp"
+
+#include "utils/Random.hpp"
+#include "utils/VectorMath.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace pricer::engines {
+
+PathNormals::PathNormals(const MonteCarloSettings& settings,
+                         std::size_t nPaths,
+                         std::size_t nSteps,
+                         unsigned long seed)
+    : settings_(settings),
+      nPaths_(nPaths),
+      nSteps_(nSteps),
+      seed_(seed),
+      nReplications_(1)
+{
+    bool sobol = (settings_.generator == RandomGenerator::Sobol);
+
+    if (sobol && settings_.scrambledReplications > 0) {
+        nReplications_ = std::min(settings_.scrambledReplications, nPaths);
+    }
+
+    if (sobol) {
+        if (nSteps_ > pricer::utils::SobolSequence::maxDimension) {
+            throw std::runtime_error("PathNormals: nSteps dépasse la dimension Sobol maximale");
+        }
+        bridge_ = std::make_unique<pricer::utils::BrownianBridge>(nSteps_);
+
+        if (settings_.scrambledReplications > 0) {
+            for (std::size_t r = 0; r < nReplications_; ++r) {
+                // seed de brouillage propre à chaque réplication
+                auto gen = pricer::utils::makeSubstream(seed_, r);
+                sobol_.emplace_back(nSteps_, static_cast<unsigned long>(gen()));
+            }
+        } else {
+            sobol_.emplace_back(nSteps_);
+        }
+    }
+
+    // Répartition des chemins entre réplications, puis en blocs
+    // (de taille paire en mode antithétique : les paires restent dans un bloc)
+    std::size_t blockSize = std::max<std::size_t>(settings_.blockSize, 1);
+    if (settings_.antithetic && blockSize % 2 != 0) {
+        ++blockSize;
+    }
+    for (std::size_t r = 0; r < nReplications_; ++r) {
+        std::size_t begin = nPaths * r / nReplications_;
+        std::size_t end   = nPaths * (r + 1) / nReplications_;
+        for (std::size_t first = begin; first < end; first += blockSize) {
+            blocks_.push_back({r, first, std::min(first + blockSize, end)});
+        }
+    }
+}
+
+PathNormals::Stream PathNormals::stream(std::size_t block) const {
+    const PathBlock& blk = blocks_.at(block);
+
+    Stream s;
+    s.nSteps_ = nSteps_;
+    s.antithetic_ = settings_.antithetic;
+
+    if (settings_.generator == RandomGenerator::Sobol) {
+        std::size_t begin = nPaths_ * blk.replication / nReplications_;
+
+        s.sobol_  = std::make_unique<pricer::utils::SobolSequence>(sobol_[blk.replication]);
+        s.bridge_ = bridge_.get();
+        s.increments_.resize(nSteps_);
+
+        // Sobol brut : on saute le point 0 (origine). En antithétique, un
+        // point sert à deux chemins.
+        std::size_t offset = (settings_.scrambledReplications > 0) ? 0 : 1;
+        std::size_t index  = blk.first - begin;
+        if (settings_.antithetic) {
+            index /= 2;
+        }
+        s.sobol_->skipTo(index + offset);
+    } else if (settings_.generator == RandomGenerator::Philox) {
+        // Accès direct : un tirage par chemin (par paire en antithétique)
+        s.philox_   = std::make_unique<pricer::utils::Philox4x32>(seed_);
+        s.nextPath_ = settings_.antithetic ? blk.first / 2 : blk.first;
+    } else {
+        s.gen_ = pricer::utils::makeSubstream(seed_, block);
+    }
+
+    return s;
+}
+
+void PathNormals::Stream::fill(double* z, std::size_t n) {
+    std::size_t half = antithetic_ ? (n + 1) / 2 : n;
+
+    generate(z, n, half);
+
+    for (std::size_t p = half; p < n; ++p) {
+        for (std::size_t i = 0; i < nSteps_; ++i) {
+            z[i * n + p] = -z[i * n + p - half];
+        }
+    }
+}
+
+void PathNormals::Stream::generate(double* z, std::size_t n, std::size_t m) {
+    if (sobol_) {
+        // Points de Sobol chemin par chemin, transformation normale
+        // vectorisée sur tout le bloc, puis pont brownien
+        uniforms_.resize(m * nSteps_);
+        gaussians_.resize(m * nSteps_);
+        for (std::size_t p = 0; p < m; ++p) {
+            sobol_->next(uniforms_.data() + p * nSteps_);
+        }
+        pricer::utils::vinverseNormalCdf(uniforms_.data(), gaussians_.data(), m * nSteps_);
+
+        double* dw = increments_.data();
+        for (std::size_t p = 0; p < m; ++p) {
+            bridge_->transform(gaussians_.data() + p * nSteps_, dw);
+            for (std::size_t i = 0; i < nSteps_; ++i) {
+                z[i * n + p] = dw[i];
+            }
+        }
+    } else if (philox_) {
+        uniforms_.resize(m * nSteps_);
+        gaussians_.resize(m * nSteps_);
+        for (std::size_t p = 0; p < m; ++p) {
+            philox_->uniforms(nextPath_ + p, 0, uniforms_.data() + p * nSteps_, nSteps_);
+        }
+        nextPath_ += m;
+        pricer::utils::vinverseNormalCdf(uniforms_.data(), gaussians_.data(), m * nSteps_);
+
+        for (std::size_t p = 0; p < m; ++p) {
+            for (std::size_t i = 0; i < nSteps_; ++i) {
+                z[i * n + p] = gaussians_[p * nSteps_ + i];
+            }
+        }
+    } else {
+        gaussians_.resize(m * nSteps_);
+        norm_.fill(gen_, gaussians_.data(), m * nSteps_);
+
+        for (std::size_t p = 0; p < m; ++p) {
+            for (std::size_t i = 0; i < nSteps_; ++i) {
+                z[i * n + p] = gaussians_[p * nSteps_ + i];
+            }
+        }
+    }
+}
+
+} 
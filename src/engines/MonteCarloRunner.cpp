@@ -0,0 +1,161 @@
+#include "engines/MonteCarloRunner.hpp"
+
+#include "utils/Cancellation.hpp"
+#include "utils/Parallel.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace pricer::engines {
+
+namespace {
+
+// Moyenne et erreur type sur les blocs [0, nBlocks)
+// blockStats[b * nEst + e] : statistiques de l'estimateur e sur le bloc b
+MonteCarloEstimate aggregate(const PathNormals& normals,
+                             const MonteCarloSettings& settings,
+                             const std::vector<PathStatistics>& blockStats,
+                             std::size_t nEst, std::size_t e,
+                             std::size_t nBlocks,
+                             const std::optional<double>& cv)
+{
+    const auto& blocks = normals.blocks();
+
+    // Réduction dans l'ordre des blocs : résultat identique au bit près
+    PathStatistics total;
+    std::vector<PathStatistics> perReplication(normals.replications());
+    MonteCarloEstimate est;
+    for (std::size_t b = 0; b < nBlocks; ++b) {
+        const PathStatistics& stats = blockStats[b * nEst + e];
+        total.merge(stats);
+        perReplication[blocks[b].replication].merge(stats);
+        est.paths += blocks[b].last - blocks[b].first;
+    }
+
+    est.mean = cv ? total.controlledMean(*cv) : total.meanY();
+
+    bool sobol = (settings.generator == RandomGenerator::Sobol);
+    if (!sobol) {
+        double var = cv ? total.controlledVariance() : total.variance();
+        est.stdError = std::sqrt(var / static_cast<double>(total.count));
+        return est;
+    }
+
+    // Quasi-aléatoire : dispersion entre réplications brouillées complètes
+    double beta = cv ? total.beta() : 0.0;
+    std::vector<double> estimates;
+    for (const auto& rep : perReplication) {
+        if (rep.count == 0) continue;
+        double m = rep.meanY();
+        if (cv) m -= beta * (rep.meanX() - *cv);
+        estimates.push_back(m);
+    }
+
+    if (settings.scrambledReplications == 0 || estimates.size() < 2) {
+        est.stdError = std::numeric_limits<double>::quiet_NaN();
+        return est;
+    }
+
+    double r = static_cast<double>(estimates.size());
+    double mean = 0.0;
+    for (double m : estimates) mean += m;
+    mean /= r;
+    double var = 0.0;
+    for (double m : estimates) var += (m - mean) * (m - mean);
+    est.stdError = std::sqrt(var / (r - 1.0) / r);
+    return est;
+}
+
+} 
+
+MonteCarloEstimate runMonteCarlo(
+    const PathNormals& normals,
+    const MonteCarloSettings& settings,
+    std::optional<double> controlExpectation,
+    double scale,
+    const std::function<void(std::size_t, PathStatistics&)>& simulateBlock)
+{
+    auto estimates = runMonteCarlo(
+        normals, settings, {controlExpectation}, {scale},
+        [&](std::size_t b, PathStatistics* stats) { simulateBlock(b, stats[0]); });
+    return estimates.front();
+}
+
+std::vector<MonteCarloEstimate> runMonteCarlo(
+    const PathNormals& normals,
+    const MonteCarloSettings& settings,
+    const std::vector<std::optional<double>>& controlExpectations,
+    const std::vector<double>& scales,
+    const std::function<void(std::size_t, PathStatistics*)>& simulateBlock,
+    std::size_t stride)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    const auto& blocks = normals.blocks();
+    std::size_t nEst = scales.size();
+    std::vector<PathStatistics> blockStats(blocks.size() * nEst);
+
+    bool adaptive = settings.targetStdError > 0.0 || settings.timeBudget > 0.0;
+    bool sobol    = (settings.generator == RandomGenerator::Sobol);
+
+    if (settings.targetStdError > 0.0 && sobol && settings.scrambledReplications < 2) {
+        throw std::runtime_error(
+            "runMonteCarlo: erreur cible impossible sans réplications Sobol brouillées");
+    }
+
+    std::vector<MonteCarloEstimate> est(nEst);
+    std::size_t done = 0;
+
+    while (done < blocks.size()) {
+        // Fin du lot : assez de chemins, sur une frontière de réplication
+        std::size_t end = blocks.size();
+        if (adaptive) {
+            std::size_t batchPaths = 0;
+            end = done;
+            while (end < blocks.size()) {
+                batchPaths += blocks[end].last - blocks[end].first;
+                ++end;
+                bool boundary = !sobol || end == blocks.size() ||
+                                blocks[end].replication != blocks[end - 1].replication;
+                if (batchPaths >= settings.batchPaths && boundary) break;
+            }
+        }
+
+        std::size_t first = done;
+        // Annulation testée avant chaque bloc de chemins
+        pricer::utils::parallelFor(end - first, settings.nThreads, [&](std::size_t k) {
+            pricer::utils::throwIfCancelled();
+            simulateBlock(first + k, blockStats.data() + (first + k) * nEst);
+        });
+        done = end;
+
+        bool reached = true;
+        for (std::size_t e = 0; e < nEst; ++e) {
+            est[e] = aggregate(normals, settings, blockStats, nEst, e, done,
+                               controlExpectations[e]);
+            if (e % stride == 0) {
+                reached = reached && scales[e] * est[e].stdError <= settings.targetStdError;
+            }
+        }
+
+        if (settings.targetStdError > 0.0 && reached) {
+            break;
+        }
+        if (settings.timeBudget > 0.0) {
+            double elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+            if (elapsed >= settings.timeBudget) break;
+        }
+    }
+
+    for (std::size_t e = 0; e < nEst; ++e) {
+        est[e].mean     *= scales[e];
+        est[e].stdError *= scales[e];
+    }
+    return est;
+}
+
+} 
@@ -0,0 +1,27 @@
+#include "engines/MonteCarloStatistics.hpp"
+
+namespace pricer::engines {
+
+void addPathSamples(PathStatistics& stats,
+                    const double* y, const double* x,
+                    std::size_t n, bool antithetic)
+{
+    std::size_t half  = antithetic ? (n + 1) / 2 : n;
+    std::size_t pairs = n - half;
+
+    for (std::size_t p = 0; p < half; ++p) {
+        double yp = y[p];
+        double xp = x ? x[p] : 0.0;
+        if (p < pairs) {
+            yp = 0.5 * (yp + y[p + half]);
+            xp = x ? 0.5 * (xp + x[p + half]) : 0.0;
+        }
+        if (x) {
+            stats.add(yp, xp);
+        } else {
+            stats.add(yp);
+        }
+    }
+}
+
+} 
@@ -0,0 +1,402 @@
+#include "engines/SharedPathMCEngine.hpp"
+
+#include "core/Instrument.hpp"
+#include "core/PayoffKernels.hpp"
+#include "products/EuropeanOption.hpp"
+#include "products/DigitalOption.hpp"
+#include "products/AsianOption.hpp"
+#include "products/BarrierOption.hpp"
+#include "engines/MonteCarloPaths.hpp"
+#include "engines/MonteCarloStatistics.hpp"
+#include "engines/MonteCarloRunner.hpp"
+#include "engines/GbmPathGenerator.hpp"
+#include "utils/AsianFormula.hpp"
+#include "utils/VectorMath.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+#include <optional>
+
+namespace pricer::engines {
+
+SharedPathMCEngine::SharedPathMCEngine(std::shared_ptr<pricer::models::BlackScholesModel> model,
+                                       double horizon,
+                                       std::size_t nSteps,
+                                       std::size_t nPaths,
+                                       unsigned long seed,
+                                       MonteCarloSettings settings)
+    : model_(std::move(model)),
+      horizon_(horizon),
+      nSteps_(nSteps),
+      nPaths_(nPaths),
+      seed_(seed),
+      settings_(settings)
+{
+    if (nPaths_ == 0 || nSteps_ == 0) {
+        throw std::runtime_error("SharedPathMCEngine: nPaths ou nSteps nul");
+    }
+    if (!(horizon_ > 0.0)) {
+        throw std::runtime_error("SharedPathMCEngine: horizon non positif");
+    }
+    if (settings_.computeGreeks) {
+        throw std::runtime_error("SharedPathMCEngine: grecques non supportées");
+    }
+    registerWith(model_);
+}
+
+std::size_t SharedPathMCEngine::gridStep(double maturity) const {
+    double dt = horizon_ / static_cast<double>(nSteps_);
+    double k  = std::round(maturity / dt);
+    if (k < 1.0 || k > static_cast<double>(nSteps_) ||
+        std::abs(k * dt - maturity) > 1e-9 * std::max(1.0, maturity)) {
+        throw std::runtime_error("SharedPathMCEngine: maturité hors de la grille de simulation");
+    }
+    return static_cast<std::size_t>(k);
+}
+
+void SharedPathMCEngine::add(const pricer::core::Instrument& inst) {
+    using namespace pricer::products;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (index_.count(&inst)) {
+        throw std::runtime_error("SharedPathMCEngine: instrument déjà enregistré");
+    }
+
+    Trade trade{};
+    if (auto const* opt = dynamic_cast<const EuropeanOption*>(&inst)) {
+        trade.kind   = TradeKind::Terminal;
+        trade.payoff = &opt->payoff();
+        trade.step   = gridStep(opt->maturity());
+    } else if (auto const* opt = dynamic_cast<const DigitalOption*>(&inst)) {
+        trade.kind   = TradeKind::Terminal;
+        trade.payoff = &opt->payoff();
+        trade.step   = gridStep(opt->maturity());
+    } else if (auto const* opt = dynamic_cast<const AsianOption*>(&inst)) {
+        if (opt->hasSchedule() || opt->averageType() != pricer::products::AverageType::Arithmetic) {
+            throw std::runtime_error("SharedPathMCEngine: asiatique à calendrier ou moyenne géométrique non supportée");
+        }
+        trade.kind   = TradeKind::Asian;
+        trade.payoff = &opt->payoff();
+        trade.step   = gridStep(opt->maturity());
+        if (settings_.controlVariate) {
+            trade.cvPayoff = pricer::core::payoffAs<pricer::core::PlainVanillaPayoff>(*trade.payoff);
+            if (!trade.cvPayoff) {
+                throw std::runtime_error("SharedPathMCEngine: variable de contrôle réservée aux payoffs vanilles");
+            }
+        }
+    } else if (auto const* opt = dynamic_cast<const BarrierOption*>(&inst)) {
+        trade.kind   = TradeKind::Barrier;
+        trade.payoff = &opt->payoff();
+        trade.step   = gridStep(opt->maturity());
+
+        auto bType = opt->barrierType();
+        bool up    = (bType == BarrierType::UpAndOut || bType == BarrierType::UpAndIn);
+        trade.out  = (bType == BarrierType::UpAndOut || bType == BarrierType::DownAndOut);
+        trade.rebate = opt->rebate();
+
+        BarrierGroup g{opt->barrier(), up, trade.step};
+        auto it = std::find_if(groups_.begin(), groups_.end(), [&](const BarrierGroup& o) {
+            return o.barrier == g.barrier && o.up == g.up && o.step == g.step;
+        });
+        trade.group = static_cast<std::size_t>(it - groups_.begin());
+        if (it == groups_.end()) groups_.push_back(g);
+        if (trade.out && trade.rebate != 0.0) groups_[trade.group].hitDiscount = true;
+    } else {
+        throw std::runtime_error("SharedPathMCEngine: mauvais type d'instrument");
+    }
+
+    index_[&inst] = trades_.size();
+    trades_.push_back(trade);
+    calculated_ = false;
+    lock.unlock();
+    notifyObservers();
+}
+
+std::size_t SharedPathMCEngine::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return trades_.size();
+}
+
+void SharedPathMCEngine::reset() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        calculated_ = false;
+    }
+    notifyObservers();
+}
+
+void SharedPathMCEngine::update() {
+    // modèle ou courbes modifiés : resimulation au prochain appel
+    reset();
+}
+
+std::shared_ptr<pricer::core::PricingEngine>
+SharedPathMCEngine::cloneImpl(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+                              std::shared_ptr<pricer::models::BlackIRModel>) const
+{
+    auto copy = std::make_shared<SharedPathMCEngine>(std::move(equity), horizon_, nSteps_, nPaths_,
+                                                     seed_, settings_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    copy->trades_ = trades_;
+    copy->groups_ = groups_;
+    copy->index_  = index_;
+    return copy;
+}
+
+double SharedPathMCEngine::priceImpl(const pricer::core::Instrument& inst) const {
+    return resultsImpl(inst).npv;
+}
+
+pricer::core::PricingResults
+SharedPathMCEngine::resultsImpl(const pricer::core::Instrument& inst) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(&inst);
+    if (it == index_.end()) {
+        throw std::runtime_error("SharedPathMCEngine: instrument non enregistré");
+    }
+    if (!calculated_) {
+        simulate();
+        calculated_ = true;
+    }
+    return results_[it->second];
+}
+
+void SharedPathMCEngine::simulate() const {
+    auto start = std::chrono::steady_clock::now();
+
+    double S0     = model_->spot();
+    double sigma  = model_->sigma();
+    double r      = model_->rate();
+    double q      = model_->dividendYield();
+
+    double dt     = horizon_ / static_cast<double>(nSteps_);
+    double drift  = (r - q - 0.5 * sigma * sigma) * dt;
+    double volDt  = sigma * std::sqrt(dt);
+
+    std::size_t nTrades = trades_.size();
+    std::size_t nGroups = groups_.size();
+
+    // Dates d'observation : spot et moyenne figés au pas de chaque maturité
+    std::vector<std::size_t> slotOfStep(nSteps_ + 1, nSteps_ + 1);
+    std::vector<std::size_t> slots;
+    for (const auto& t : trades_) {
+        if (slotOfStep[t.step] > nSteps_) {
+            slotOfStep[t.step] = slots.size();
+            slots.push_back(t.step);
+        }
+    }
+    std::size_t nSlots = slots.size();
+
+    std::vector<std::optional<double>> cvExpectations(nTrades);
+    std::vector<double> scales(nTrades);
+    bool needLogSum = false;
+    for (std::size_t t = 0; t < nTrades; ++t) {
+        const Trade& trade = trades_[t];
+        scales[t] = model_->discount(dt * static_cast<double>(trade.step));
+        if (trade.cvPayoff) {
+            std::vector<double> fixings(trade.step);
+            for (std::size_t i = 0; i < trade.step; ++i) {
+                fixings[i] = dt * static_cast<double>(i + 1);
+            }
+            cvExpectations[t] = pricer::utils::geometricAsianUndiscounted(
+                S0, trade.cvPayoff->strike(), r, q, sigma, fixings, trade.cvPayoff->type());
+            needLogSum = true;
+        }
+    }
+
+    bool continuous = (settings_.barrierMonitoring == BarrierMonitoring::Continuous);
+    double bridgeScale = -2.0 / (sigma * sigma * dt);
+    std::vector<double> logMoneyness(nGroups);
+    for (std::size_t g = 0; g < nGroups; ++g) {
+        logMoneyness[g] = std::log(S0 / groups_[g].barrier);
+    }
+
+    // Rebate d'un knock-out payé au contact, comme BarrierOptionMCEngine :
+    // par groupe, espérance de D(t_contact) sur le chemin, ramenée ensuite
+    // en unités du payoff par D(T)
+    std::vector<double> discountAt(nSteps_);
+    for (std::size_t i = 0; i < nSteps_; ++i) {
+        discountAt[i] = model_->discount(dt * static_cast<double>(i + 1));
+    }
+
+    // Découpage en blocs indépendant du nombre de threads
+    PathNormals normals(settings_, nPaths_, nSteps_, seed_);
+    const auto& blocks = normals.blocks();
+
+    auto simulateBlock = [&](std::size_t b, PathStatistics* stats) {
+        auto stream = normals.stream(b);
+        GbmPathGenerator paths(S0, drift, volDt, nSteps_);
+        std::vector<double> z, logS, sumS, sumLogS;
+        std::vector<double> spotAt, sumAt, logSumAt;
+        std::vector<unsigned char> hit;
+        std::vector<double> crossing, survival, hitDiscount;
+        std::vector<double> payoffs, cvPayoffs;
+
+        for (std::size_t first = blocks[b].first; first < blocks[b].last;
+             first += GbmPathGenerator::lockstepPaths) {
+            std::size_t n = std::min(GbmPathGenerator::lockstepPaths, blocks[b].last - first);
+
+            z.resize(nSteps_ * n);
+            stream.fill(z.data(), n);
+
+            logS.assign(n, 0.0);
+            sumS.assign(n, 0.0);
+            sumLogS.assign(n, 0.0);
+            spotAt.resize(nSlots * n);
+            sumAt.resize(nSlots * n);
+            logSumAt.resize(nSlots * n);
+            if (continuous) {
+                crossing.resize(n);
+                survival.assign(nGroups * n, 1.0);
+            } else {
+                hit.assign(nGroups * n, 0);
+            }
+            hitDiscount.assign(nGroups * n, 0.0);
+
+            paths.simulate(z.data(), n, [&](std::size_t i, const double* S) {
+                std::size_t k = i + 1;
+                const double* zi = z.data() + i * n;
+                for (std::size_t p = 0; p < n; ++p) {
+                    logS[p] += drift + volDt * zi[p];
+                    sumS[p] += S[p];
+                }
+                if (needLogSum) {
+                    for (std::size_t p = 0; p < n; ++p) sumLogS[p] += logS[p];
+                }
+
+                for (std::size_t g = 0; g < nGroups; ++g) {
+                    const BarrierGroup& grp = groups_[g];
+                    if (k > grp.step) continue;
+
+                    if (continuous) {
+                        // même pont brownien que BarrierOptionMCEngine,
+                        // avec x = ln(S/B) = ln(S0/B) + log-incréments cumulés
+                        double* surv = survival.data() + g * n;
+                        for (std::size_t p = 0; p < n; ++p) {
+                            double xNext = logMoneyness[g] + logS[p];
+                            double xPrev = xNext - (drift + volDt * zi[p]);
+                            bool safe = grp.up ? (xPrev < 0.0 && xNext < 0.0)
+                                               : (xPrev > 0.0 && xNext > 0.0);
+                            crossing[p] = safe ? bridgeScale * xPrev * xNext : 0.0;
+                        }
+                        pricer::utils::vexp(crossing.data(), crossing.data(), n);
+                        if (grp.hitDiscount) {
+                            double* hd = hitDiscount.data() + g * n;
+                            for (std::size_t p = 0; p < n; ++p) {
+                                double sNew = surv[p] * (1.0 - crossing[p]);
+                                hd[p] += discountAt[i] * (surv[p] - sNew);
+                                surv[p] = sNew;
+                            }
+                        } else {
+                            for (std::size_t p = 0; p < n; ++p) {
+                                surv[p] *= 1.0 - crossing[p];
+                            }
+                        }
+                    } else {
+                        unsigned char* h = hit.data() + g * n;
+                        double B = grp.barrier;
+                        if (grp.hitDiscount) {
+                            // date du premier contact nécessaire pour le rebate
+                            double* hd = hitDiscount.data() + g * n;
+                            for (std::size_t p = 0; p < n; ++p) {
+                                bool crossed = grp.up ? (S[p] >= B) : (S[p] <= B);
+                                if (crossed && !h[p]) {
+                                    h[p] = 1;
+                                    hd[p] = discountAt[i];
+                                }
+                            }
+                        } else if (grp.up) {
+                            for (std::size_t p = 0; p < n; ++p) h[p] |= (S[p] >= B);
+                        } else {
+                            for (std::size_t p = 0; p < n; ++p) h[p] |= (S[p] <= B);
+                        }
+                    }
+                }
+
+                std::size_t slot = slotOfStep[k];
+                if (slot < nSlots) {
+                    std::copy(S, S + n, spotAt.data() + slot * n);
+                    std::copy(sumS.begin(), sumS.end(), sumAt.data() + slot * n);
+                    std::copy(sumLogS.begin(), sumLogS.end(), logSumAt.data() + slot * n);
+                }
+            });
+
+            // Évaluation des payoffs sur les chemins du paquet
+            payoffs.resize(n);
+            cvPayoffs.resize(n);
+            for (std::size_t t = 0; t < nTrades; ++t) {
+                const Trade& trade = trades_[t];
+                std::size_t slot = slotOfStep[trade.step];
+                const double* ST = spotAt.data() + slot * n;
+
+                // noyau de payoff résolu une fois par produit et par paquet
+                pricer::core::visitPayoff(*trade.payoff, [&](const auto& payoff) {
+                    switch (trade.kind) {
+                    case TradeKind::Terminal:
+                        for (std::size_t p = 0; p < n; ++p) payoffs[p] = payoff(ST[p]);
+                        break;
+
+                    case TradeKind::Asian: {
+                        double m = static_cast<double>(trade.step);
+                        const double* sum = sumAt.data() + slot * n;
+                        for (std::size_t p = 0; p < n; ++p) payoffs[p] = payoff(sum[p] / m);
+                        if (trade.cvPayoff) {
+                            const double* logSum = logSumAt.data() + slot * n;
+                            for (std::size_t p = 0; p < n; ++p) {
+                                cvPayoffs[p] = (*trade.cvPayoff)(S0 * std::exp(logSum[p] / m));
+                            }
+                        }
+                        break;
+                    }
+
+                    case TradeKind::Barrier: {
+                        // rebate du knock-out : R D(t_contact) / D(T)
+                        double R = trade.rebate;
+                        double growth = R / scales[t];
+                        const double* hd = hitDiscount.data() + trade.group * n;
+                        if (continuous) {
+                            const double* surv = survival.data() + trade.group * n;
+                            for (std::size_t p = 0; p < n; ++p) {
+                                double f = payoff(ST[p]);
+                                payoffs[p] = trade.out ? surv[p] * f + growth * hd[p]
+                                                       : (1.0 - surv[p]) * f + surv[p] * R;
+                            }
+                        } else {
+                            const unsigned char* h = hit.data() + trade.group * n;
+                            for (std::size_t p = 0; p < n; ++p) {
+                                bool alive = trade.out ? !h[p] : h[p];
+                                double dead = trade.out ? growth * hd[p] : R;
+                                payoffs[p] = alive ? payoff(ST[p]) : dead;
+                            }
+                        }
+                        break;
+                    }
+                    }
+                });
+
+                addPathSamples(stats[t], payoffs.data(),
+                               trade.cvPayoff ? cvPayoffs.data() : nullptr,
+                               n, settings_.antithetic);
+            }
+        }
+    };
+
+    auto estimates = runMonteCarlo(normals, settings_, cvExpectations, scales, simulateBlock);
+
+    // Le temps reporté est celui de la simulation commune
+    double elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    results_.assign(nTrades, {});
+    for (std::size_t t = 0; t < nTrades; ++t) {
+        results_[t].npv            = estimates[t].mean;
+        results_[t].stdError       = estimates[t].stdError;
+        results_[t].paths          = estimates[t].paths;
+        results_[t].elapsedSeconds = elapsed;
+    }
+}
+
+} 
@@ -3,13 +3,46 @@
 #include "products/Swap.hpp"
 #include "core/Payoff.hpp"
 #include "utils/BlackFormula.hpp"
+#include "engines/AnalyticGreeks.hpp"
 
+#include <chrono>
 #include <cmath>
 #include <stdexcept>
 #include <algorithm>
+#include <vector>
 
 namespace pricer::engines {
 
+namespace {
+
+// Annuité A = somme accr_i * DF(t_i), DF lus sur le modèle et, si
+// demandé, dA/dr pour un déplacement parallèle de la courbe
+double swapAnnuity(const pricer::products::InterestRateSwap& swap,
+                   const pricer::models::BlackIRModel& model,
+                   const char* sizeError,
+                   double* dAdr = nullptr)
+{
+    const auto& times = swap.paymentTimes();
+    const auto& accr  = swap.accruals();
+
+    if (times.size() != accr.size()) {
+        throw std::runtime_error(sizeError);
+    }
+
+    double A = 0.0, dA = 0.0;
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        double w = accr[i] * model.discount(times[i]);
+        A  += w;
+        dA -= times[i] * w;
+    }
+    if (dAdr) *dAdr = dA;
+    return A;
+}
+
+constexpr const char* kSwaptionSizeError =
+    "SwaptionBlackEngine: tailles times/accruals incohérentes";
+
+} 
 
 
 double SwapEngine::priceImpl(const pricer::core::Instrument& inst) const {
@@ -40,6 +73,22 @@ double SwapEngine::priceImpl(const pricer::core::Instrument& inst) const {
 }
 
 
+void SwapEngine::batchImpl(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<double> out) const
+{
+    for (std::size_t i = 0; i < instruments.size(); ++i) {
+        auto const* swap = pricer::core::instrumentAs<pricer::products::InterestRateSwap>(*instruments[i]);
+        if (!swap) {
+            throw std::runtime_error("SwapEngine: mauvais type d'instrument");
+        }
+        double A    = swapAnnuity(*swap, *model_, "SwapEngine: tailles times/accruals incohérentes");
+        double sign = swap->payer() ? 1.0 : -1.0;
+        out[i] = sign * swap->notional() * A * (swap->forwardRate() - swap->fixedRate());
+    }
+}
+
+
 double SwaptionBlackEngine::priceImpl(const pricer::core::Instrument& inst) const {
     auto const* swpt = dynamic_cast<const pricer::products::Swaption*>(&inst);
     if (!swpt) {
@@ -90,4 +139,99 @@ double SwaptionBlackEngine::priceImpl(const pricer::core::Instrument& inst) cons
     return price;
 }
 
+pricer::core::PricingResults
+SwaptionBlackEngine::resultsImpl(const pricer::core::Instrument& inst) const {
+    auto const* swpt = dynamic_cast<const pricer::products::Swaption*>(&inst);
+    if (!swpt) {
+        throw std::runtime_error("SwaptionBlackEngine: mauvais type d'instrument");
+    }
+
+    double Texp = swpt->exerciseTime();
+    if (Texp <= 0.0) {
+        return PricingEngine::resultsImpl(inst);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    const auto& swap = swpt->underlying();
+    double dAdr  = 0.0;
+    double A     = swapAnnuity(swap, *model_, kSwaptionSizeError, &dAdr);
+    double sigma = model_->sigma();
+
+    pricer::core::OptionType type =
+        swap.payer() ? pricer::core::OptionType::Call : pricer::core::OptionType::Put;
+
+    auto b = pricer::utils::blackForwardSensitivities(
+        swap.forwardRate(), swap.fixedRate(), sigma * std::sqrt(Texp), type);
+
+    pricer::core::PricingResults res;
+    res.npv = swap.notional() * A * b.value;
+    res.greeks = blackRatesGreeks(b, swap.notional(), A, dAdr, model_->rate(), sigma, Texp);
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+void SwaptionBlackEngine::batchImpl(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<double> out) const
+{
+    double sigma = model_->sigma();
+
+    // Swaptions non échues rangées en tableaux pour un seul appel Black
+    std::size_t n = instruments.size();
+    std::vector<double> F, K, stdDev, weight, prices;
+    std::vector<pricer::core::OptionType> types;
+    std::vector<std::size_t> index;
+    F.reserve(n); K.reserve(n); stdDev.reserve(n); weight.reserve(n);
+    types.reserve(n); index.reserve(n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const* swpt = pricer::core::instrumentAs<pricer::products::Swaption>(*instruments[i]);
+        if (!swpt) {
+            throw std::runtime_error("SwaptionBlackEngine: mauvais type d'instrument");
+        }
+        double Texp = swpt->exerciseTime();
+        if (Texp <= 0.0) {
+            out[i] = priceImpl(*swpt);
+            continue;
+        }
+        const auto& swap = swpt->underlying();
+        F.push_back(swap.forwardRate());
+        K.push_back(swap.fixedRate());
+        stdDev.push_back(sigma * std::sqrt(Texp));
+        weight.push_back(swap.notional() * swapAnnuity(swap, *model_, kSwaptionSizeError));
+        types.push_back(swap.payer() ? pricer::core::OptionType::Call
+                                     : pricer::core::OptionType::Put);
+        index.push_back(i);
+    }
+
+    prices.resize(index.size());
+    pricer::utils::blackForwardBatch(F, K, stdDev, types, weight, prices);
+    for (std::size_t j = 0; j < index.size(); ++j) {
+        out[index[j]] = prices[j];
+    }
+}
+
+double SwaptionBlackEngine::impliedVolatility(const pricer::products::Swaption& swpt,
+                                              double price) const
+{
+    const auto& swap = swpt.underlying();
+
+    double Texp = swpt.exerciseTime();
+    if (Texp <= 0.0) {
+        throw std::runtime_error("SwaptionBlackEngine: volatilité implicite d'une swaption échue");
+    }
+
+    double A = swapAnnuity(swap, *model_, kSwaptionSizeError);
+
+    pricer::core::OptionType type =
+        swap.payer() ? pricer::core::OptionType::Call : pricer::core::OptionType::Put;
+
+    double stdDev = pricer::utils::impliedBlackStdDev(
+        price / (swap.notional() * A), swap.forwardRate(), swap.fixedRate(), type);
+
+    return stdDev / std::sqrt(Texp);
+}
+
 } 
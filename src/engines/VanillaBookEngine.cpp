@@ -0,0 +1,143 @@
+#include "engines/VanillaBookEngine.hpp"
+
+#include "core/Payoff.hpp"
+#include "utils/BlackFormula.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/VectorMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace pricer::engines {
+
+namespace {
+
+struct Market {
+    double spot, rate, dividendYield, sigma;
+};
+
+// Trades [first, first + m), m <= kChunk
+constexpr std::size_t kChunk = 256;
+
+void priceChunk(const pricer::products::VanillaBook& book,
+                const std::vector<Market>& markets,
+                std::size_t first, std::size_t m, double* out,
+                pricer::utils::SimdLevel level)
+{
+    using pricer::core::OptionType;
+    using pricer::products::VanillaKind;
+
+    const VanillaKind* kind = book.kinds().data() + first;
+    const OptionType* type  = book.types().data() + first;
+    const double* K         = book.strikes().data() + first;
+    const double* T         = book.maturities().data() + first;
+    const double* Q         = book.payouts().data() + first;
+    const std::uint32_t* u  = book.underlyings().data() + first;
+
+    // a[0, m) : (r - q) T, a[m, 2m) : -r T ; e = exp(a). Mis à zéro : seules
+    // 2m valeurs sont écrites, ce que le compilateur ne peut pas vérifier
+    double a[2 * kChunk] = {};
+    double e[2 * kChunk];
+    double sd[kChunk];
+    double lnFK[kChunk];
+    double d[2 * kChunk];
+    double N[2 * kChunk];
+    double phi[kChunk];
+
+    for (std::size_t i = 0; i < m; ++i) {
+        if (u[i] >= markets.size()) {
+            throw std::runtime_error("VanillaBookEngine: sous-jacent inconnu");
+        }
+        const Market& mk = markets[u[i]];
+        double t = std::max(T[i], 0.0);
+        a[i]     = (mk.rate - mk.dividendYield) * t;
+        a[m + i] = -mk.rate * t;
+        sd[i]    = mk.sigma * std::sqrt(t);
+    }
+    pricer::utils::vexp(a, e, 2 * m, level);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        double F = markets[u[i]].spot * e[i];
+        e[i] = F;
+        lnFK[i] = (F > 0.0 && K[i] > 0.0) ? F / K[i] : 1.0;
+    }
+    pricer::utils::vlog(lnFK, lnFK, m, level);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        double s  = (sd[i] > 0.0) ? sd[i] : 1.0;
+        double d1 = (lnFK[i] + 0.5 * s * s) / s;
+        phi[i]   = (type[i] == OptionType::Call) ? 1.0 : -1.0;
+        d[i]     = phi[i] * d1;
+        d[m + i] = phi[i] * (d1 - s);
+    }
+    pricer::utils::vnormalCdf(d, N, 2 * m, level);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        double F  = e[i];
+        double df = e[m + i];
+        bool digital = (kind[i] == VanillaKind::Digital);
+
+        if (T[i] <= 0.0) {
+            // échue : payoff au spot, comme les moteurs objet
+            double S = markets[u[i]].spot;
+            out[i] = digital ? pricer::core::DigitalPayoff(type[i], K[i], Q[i])(S)
+                             : pricer::core::PlainVanillaPayoff(type[i], K[i])(S);
+        } else if (sd[i] <= 0.0 || F <= 0.0 || K[i] <= 0.0) {
+            out[i] = df * (digital ? pricer::utils::blackDigitalForward(F, K[i], sd[i], type[i], Q[i])
+                                   : pricer::utils::blackForward(F, K[i], sd[i], type[i]));
+        } else if (digital) {
+            out[i] = df * Q[i] * N[m + i];
+        } else {
+            out[i] = df * phi[i] * (F * N[i] - K[i] * N[m + i]);
+        }
+    }
+}
+
+} 
+
+VanillaBookEngine::VanillaBookEngine(std::shared_ptr<pricer::models::BlackScholesModel> model)
+    : VanillaBookEngine(std::vector<std::shared_ptr<pricer::models::BlackScholesModel>>{std::move(model)})
+{}
+
+VanillaBookEngine::VanillaBookEngine(
+    std::vector<std::shared_ptr<pricer::models::BlackScholesModel>> underlyings)
+    : underlyings_(std::move(underlyings))
+{
+    for (const auto& model : underlyings_) {
+        if (!model) {
+            throw std::runtime_error("VanillaBookEngine: modèle nul");
+        }
+    }
+}
+
+void VanillaBookEngine::price(const pricer::products::VanillaBook& book,
+                              pricer::utils::Span<double> out,
+                              std::size_t nThreads) const
+{
+    if (out.size() != book.size()) {
+        throw std::runtime_error("VanillaBookEngine: tailles différentes");
+    }
+
+    std::vector<Market> markets;
+    markets.reserve(underlyings_.size());
+    for (const auto& model : underlyings_) {
+        markets.push_back({model->spot(), model->rate(), model->dividendYield(), model->sigma()});
+    }
+
+    // Tâches de 64 paquets : assez grosses pour amortir la distribution
+    constexpr std::size_t kTask = 64 * kChunk;
+    auto level = pricer::utils::detectSimdLevel();
+    std::size_t n = book.size();
+    std::size_t nTasks = (n + kTask - 1) / kTask;
+
+    pricer::utils::parallelFor(nTasks, nThreads, [&](std::size_t t) {
+        std::size_t last = std::min(n, (t + 1) * kTask);
+        for (std::size_t first = t * kTask; first < last; first += kChunk) {
+            priceChunk(book, markets, first, std::min(kChunk, last - first),
+                       out.data() + first, level);
+        }
+    });
+}
+
+} 
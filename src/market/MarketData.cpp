@@ -1,10 +1,40 @@
 #include "market/MarketData.hpp"
+#include "utils/VectorMath.hpp"
 #include <cmath>
+#include <stdexcept>
 
 namespace pricer::market {
 
 double YieldCurve::discount(double T) const {
-    return std::exp(-r_ * T);
+    return std::exp(-rate() * T);
+}
+
+void YieldCurve::discount(pricer::utils::Span<const double> times,
+                          pricer::utils::Span<double> out) const
+{
+    if (times.size() != out.size()) {
+        throw std::runtime_error("YieldCurve::discount: tailles différentes");
+    }
+    double r = rate();
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        out[i] = -r * times[i];
+    }
+    pricer::utils::vexp(out.data(), out.data(), out.size());
+}
+
+void YieldCurve::setRate(double flatRate) {
+    r_.store(flatRate, std::memory_order_relaxed);
+    notifyObservers();
+}
+
+void EquityCurve::setSpot(double spot) {
+    spot_.store(spot, std::memory_order_relaxed);
+    notifyObservers();
+}
+
+void EquityCurve::setDividendYield(double dividendYield) {
+    q_.store(dividendYield, std::memory_order_relaxed);
+    notifyObservers();
 }
 
 } 
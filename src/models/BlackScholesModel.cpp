@@ -1,5 +1,7 @@
 #include "models/BlackScholesModel.hpp"
+#include "utils/VectorMath.hpp"
 #include <cmath>
+#include <stdexcept>
 
 namespace pricer::models {
 
@@ -18,6 +20,28 @@ double BlackScholesModel::forward(double T) const {
     return S0 * std::exp((r - q) * T);
 }
 
+void BlackScholesModel::discount(pricer::utils::Span<const double> times,
+                                 pricer::utils::Span<double> out) const
+{
+    discountCurve_->discount(times, out);
+}
+
+void BlackScholesModel::forward(pricer::utils::Span<const double> times,
+                                pricer::utils::Span<double> out) const
+{
+    if (times.size() != out.size()) {
+        throw std::runtime_error("BlackScholesModel::forward: tailles différentes");
+    }
+    double S0 = equityCurve_->spot();
+    double r  = discountCurve_->rate();
+    double q  = equityCurve_->dividendYield();
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        out[i] = (r - q) * times[i];
+    }
+    pricer::utils::vexp(out.data(), out.data(), out.size());
+    for (double& f : out) f *= S0;
+}
+
 double BlackScholesModel::rate() const {
     return discountCurve_->rate();
 }
@@ -26,5 +50,9 @@ double BlackScholesModel::dividendYield() const {
     return equityCurve_->dividendYield();
 }
 
+void BlackScholesModel::setSigma(double sigma) {
+    sigma_.store(sigma, std::memory_order_relaxed);
+    notifyObservers();
+}
 
-} 
+}
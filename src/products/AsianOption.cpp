@@ -1,4 +1,31 @@
 #include "products/AsianOption.hpp"
 
+#include <stdexcept>
+
 namespace pricer::products {
+
+AsianOption::AsianOption(pricer::core::PayoffPtr payoff,
+                         double maturity,
+                         std::vector<double> fixingTimes,
+                         AverageType averageType,
+                         std::vector<double> pastFixings)
+    : payoff_(std::move(payoff)),
+      maturity_(maturity),
+      averageType_(averageType),
+      fixingTimes_(std::move(fixingTimes)),
+      pastFixings_(std::move(pastFixings))
+{
+    for (std::size_t i = 0; i < fixingTimes_.size(); ++i) {
+        double t = fixingTimes_[i];
+        if (t <= 0.0 || t > maturity_ || (i > 0 && t <= fixingTimes_[i - 1])) {
+            throw std::runtime_error("AsianOption: dates de fixing non croissantes ou hors de ]0, T]");
+        }
+    }
+    for (double s : pastFixings_) {
+        if (s <= 0.0) {
+            throw std::runtime_error("AsianOption: fixing passé non positif");
+        }
+    }
 }
+
+} 
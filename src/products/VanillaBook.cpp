@@ -0,0 +1,115 @@
+#include "products/VanillaBook.hpp"
+
+#include "products/EuropeanOption.hpp"
+#include "products/DigitalOption.hpp"
+
+#include <stdexcept>
+
+namespace pricer::products {
+
+void VanillaBook::reserve(std::size_t n) {
+    kind_.reserve(n);
+    type_.reserve(n);
+    strike_.reserve(n);
+    maturity_.reserve(n);
+    payout_.reserve(n);
+    underlying_.reserve(n);
+}
+
+void VanillaBook::clear() {
+    kind_.clear();
+    type_.clear();
+    strike_.clear();
+    maturity_.clear();
+    payout_.clear();
+    underlying_.clear();
+}
+
+void VanillaBook::push(VanillaKind kind, pricer::core::OptionType type, double strike,
+                       double maturity, double payout, std::uint32_t underlying)
+{
+    kind_.push_back(kind);
+    type_.push_back(type);
+    strike_.push_back(strike);
+    maturity_.push_back(maturity);
+    payout_.push_back(payout);
+    underlying_.push_back(underlying);
+}
+
+void VanillaBook::addEuropean(pricer::core::OptionType type, double strike, double maturity,
+                              std::uint32_t underlying)
+{
+    push(VanillaKind::European, type, strike, maturity, 0.0, underlying);
+}
+
+void VanillaBook::addDigital(pricer::core::OptionType type, double strike, double maturity,
+                             double payout, std::uint32_t underlying)
+{
+    push(VanillaKind::Digital, type, strike, maturity, payout, underlying);
+}
+
+void VanillaBook::add(const pricer::core::Instrument& inst, std::uint32_t underlying) {
+    using namespace pricer::core;
+
+    if (auto const* opt = instrumentAs<EuropeanOption>(inst)) {
+        if (auto const* pv = payoffAs<PlainVanillaPayoff>(opt->payoff())) {
+            addEuropean(pv->type(), pv->strike(), opt->maturity(), underlying);
+            return;
+        }
+    } else if (auto const* opt = instrumentAs<DigitalOption>(inst)) {
+        if (auto const* dp = payoffAs<DigitalPayoff>(opt->payoff())) {
+            addDigital(dp->type(), dp->strike(), opt->maturity(), dp->payout(), underlying);
+            return;
+        }
+    }
+    throw std::runtime_error("VanillaBook: instrument ou payoff non supporté");
+}
+
+bool VanillaBook::supports(const pricer::core::Instrument& inst) {
+    using namespace pricer::core;
+
+    if (auto const* opt = instrumentAs<EuropeanOption>(inst)) {
+        return payoffAs<PlainVanillaPayoff>(opt->payoff()) != nullptr;
+    }
+    if (auto const* opt = instrumentAs<DigitalOption>(inst)) {
+        return payoffAs<DigitalPayoff>(opt->payoff()) != nullptr;
+    }
+    return false;
+}
+
+VanillaBook VanillaBook::fromInstruments(
+    pricer::utils::Span<const pricer::core::Instrument* const> instruments,
+    pricer::utils::Span<const std::uint32_t> underlyings)
+{
+    if (!underlyings.empty() && underlyings.size() != instruments.size()) {
+        throw std::runtime_error("VanillaBook: tailles instruments/sous-jacents différentes");
+    }
+    VanillaBook book;
+    book.reserve(instruments.size());
+    for (std::size_t i = 0; i < instruments.size(); ++i) {
+        book.add(*instruments[i], underlyings.empty() ? 0 : underlyings[i]);
+    }
+    return book;
+}
+
+std::unique_ptr<pricer::core::Instrument> VanillaBook::instrument(std::size_t i) const {
+    using namespace pricer::core;
+
+    if (kind_[i] == VanillaKind::Digital) {
+        return std::make_unique<DigitalOption>(
+            std::make_unique<DigitalPayoff>(type_[i], strike_[i], payout_[i]), maturity_[i]);
+    }
+    return std::make_unique<EuropeanOption>(
+        std::make_unique<PlainVanillaPayoff>(type_[i], strike_[i]), maturity_[i]);
+}
+
+std::vector<std::unique_ptr<pricer::core::Instrument>> VanillaBook::toInstruments() const {
+    std::vector<std::unique_ptr<pricer::core::Instrument>> out;
+    out.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        out.push_back(instrument(i));
+    }
+    return out;
+}
+
+} 
@@ -0,0 +1,33 @@
+#include "risk/Scenario.hpp"
+
+#include <stdexcept>
+
+namespace pricer::risk {
+
+ScenarioSet::ScenarioSet(std::size_t nUnderlyings)
+    : nUnderlyings_(nUnderlyings)
+{}
+
+void ScenarioSet::reserve(std::size_t nScenarios) {
+    rates_.reserve(nScenarios);
+    equities_.reserve(nScenarios * nUnderlyings_);
+}
+
+void ScenarioSet::add(const RateShift& rates, pricer::utils::Span<const EquityShift> equities) {
+    if (equities.size() != nUnderlyings_) {
+        throw std::runtime_error("ScenarioSet: nombre de sous-jacents différent");
+    }
+    for (const auto& shift : equities) {
+        if (!(shift.spot > -1.0)) {
+            throw std::runtime_error("ScenarioSet: choc de spot <= -100%");
+        }
+    }
+    rates_.push_back(rates);
+    equities_.insert(equities_.end(), equities.begin(), equities.end());
+}
+
+void ScenarioSet::add(const RateShift& rates, const EquityShift& equity) {
+    add(rates, pricer::utils::Span<const EquityShift>(&equity, 1));
+}
+
+} 
@@ -0,0 +1,350 @@
+#include "risk/ScenarioEngine.hpp"
+
+#include "core/EngineFactory.hpp"
+#include "core/Payoff.hpp"
+#include "core/Portfolio.hpp"
+#include "market/MarketData.hpp"
+#include "utils/BlackFormula.hpp"
+#include "utils/Cancellation.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/VectorMath.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace pricer::risk {
+
+namespace {
+
+// Marché choqué d'un sous-jacent dans un scénario
+struct Market {
+    double spot, lnSpot, rate, dividendYield, sigma;
+};
+
+// Tuile : kChunk trades (invariants en L1) x kScenarioBlock scénarios ;
+// une tâche parcourt kTradeBlock trades pour un bloc de scénarios
+constexpr std::size_t kChunk         = 256;
+constexpr std::size_t kScenarioBlock = 32;
+constexpr std::size_t kTradeBlock    = 16 * kChunk;
+
+// Invariants par trade, indépendants du marché
+struct TradeColumns {
+    std::vector<double> lnStrike;
+    std::vector<double> maturity;   // T, ramené à 0 si échu
+    std::vector<double> sqrtT;
+    std::vector<double> phi;        // +1 call, -1 put
+};
+
+TradeColumns hoistTrades(const pricer::products::VanillaBook& book,
+                         pricer::utils::SimdLevel level)
+{
+    std::size_t n = book.size();
+    TradeColumns cols;
+    cols.lnStrike.resize(n);
+    cols.maturity.resize(n);
+    cols.sqrtT.resize(n);
+    cols.phi.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double K = book.strikes()[i];
+        double t = std::max(book.maturities()[i], 0.0);
+        cols.lnStrike[i] = (K > 0.0) ? K : 1.0;  // K <= 0 : formule dégénérée
+        cols.maturity[i] = t;
+        cols.sqrtT[i]    = std::sqrt(t);
+        cols.phi[i]      = (book.types()[i] == pricer::core::OptionType::Call) ? 1.0 : -1.0;
+    }
+    pricer::utils::vlog(cols.lnStrike.data(), cols.lnStrike.data(), n, level);
+    return cols;
+}
+
+// Somme des prix des trades [first, first + m), m <= kChunk, sur le marché
+// mk (un Market par sous-jacent) : ln F = ln S + (r - q) T, deux vexp et
+// deux vnormalCdf par trade, sans log
+double chunkValue(const pricer::products::VanillaBook& book, const TradeColumns& cols,
+                  const Market* mk, std::size_t first, std::size_t m,
+                  pricer::utils::SimdLevel level)
+{
+    using pricer::core::OptionType;
+    using pricer::products::VanillaKind;
+
+    const VanillaKind* kind = book.kinds().data() + first;
+    const OptionType* type  = book.types().data() + first;
+    const double* K         = book.strikes().data() + first;
+    const double* Tbook     = book.maturities().data() + first;
+    const double* Q         = book.payouts().data() + first;
+    const std::uint32_t* u  = book.underlyings().data() + first;
+    const double* lnK       = cols.lnStrike.data() + first;
+    const double* T         = cols.maturity.data() + first;
+    const double* sqrtT     = cols.sqrtT.data() + first;
+    const double* phi       = cols.phi.data() + first;
+
+    // a[0, m) : ln F, a[m, 2m) : -r T ; e = exp(a). Mis à zéro : seules
+    // 2m valeurs sont écrites, ce que le compilateur ne peut pas vérifier
+    double a[2 * kChunk] = {};
+    double e[2 * kChunk];
+    double sd[kChunk];
+    double d[2 * kChunk];
+    double N[2 * kChunk];
+
+    for (std::size_t i = 0; i < m; ++i) {
+        const Market& k = mk[u[i]];
+        a[i]     = k.lnSpot + (k.rate - k.dividendYield) * T[i];
+        a[m + i] = -k.rate * T[i];
+        sd[i]    = k.sigma * sqrtT[i];
+    }
+    pricer::utils::vexp(a, e, 2 * m, level);
+
+    for (std::size_t i = 0; i < m; ++i) {
+        double s  = (sd[i] > 0.0) ? sd[i] : 1.0;
+        double d1 = (a[i] - lnK[i]) / s + 0.5 * s;
+        d[i]     = phi[i] * d1;
+        d[m + i] = phi[i] * (d1 - s);
+    }
+    pricer::utils::vnormalCdf(d, N, 2 * m, level);
+
+    double sum = 0.0;
+    for (std::size_t i = 0; i < m; ++i) {
+        double F  = e[i];
+        double df = e[m + i];
+        bool digital = (kind[i] == VanillaKind::Digital);
+
+        if (Tbook[i] <= 0.0) {
+            double S = mk[u[i]].spot;
+            sum += digital ? pricer::core::DigitalPayoff(type[i], K[i], Q[i])(S)
+                           : pricer::core::PlainVanillaPayoff(type[i], K[i])(S);
+        } else if (sd[i] <= 0.0 || K[i] <= 0.0) {
+            sum += df * (digital ? pricer::utils::blackDigitalForward(F, K[i], sd[i], type[i], Q[i])
+                                 : pricer::utils::blackForward(F, K[i], sd[i], type[i]));
+        } else if (digital) {
+            sum += df * Q[i] * N[m + i];
+        } else {
+            sum += df * phi[i] * (F * N[i] - K[i] * N[m + i]);
+        }
+    }
+    return sum;
+}
+
+} 
+
+ScenarioEngine::ScenarioEngine(
+    std::vector<std::shared_ptr<pricer::models::BlackScholesModel>> equities,
+    std::shared_ptr<pricer::models::BlackIRModel> rates)
+    : equities_(std::move(equities)),
+      rates_(std::move(rates))
+{
+    if (!rates_) {
+        throw std::runtime_error("ScenarioEngine: modèle de taux nul");
+    }
+    for (const auto& model : equities_) {
+        if (!model) {
+            throw std::runtime_error("ScenarioEngine: modèle action nul");
+        }
+    }
+}
+
+ScenarioEngine::ScenarioEngine(std::shared_ptr<pricer::models::BlackScholesModel> equity,
+                               std::shared_ptr<pricer::models::BlackIRModel> rates)
+    : ScenarioEngine(std::vector<std::shared_ptr<pricer::models::BlackScholesModel>>{std::move(equity)},
+                     std::move(rates))
+{}
+
+void ScenarioEngine::add(const pricer::products::VanillaBook& book) {
+    for (std::uint32_t u : book.underlyings()) {
+        if (u >= equities_.size()) {
+            throw std::runtime_error("ScenarioEngine: sous-jacent inconnu");
+        }
+    }
+    book_.reserve(book_.size() + book.size());
+    for (std::size_t i = 0; i < book.size(); ++i) {
+        if (book.kinds()[i] == pricer::products::VanillaKind::Digital) {
+            book_.addDigital(book.types()[i], book.strikes()[i], book.maturities()[i],
+                             book.payouts()[i], book.underlyings()[i]);
+        } else {
+            book_.addEuropean(book.types()[i], book.strikes()[i], book.maturities()[i],
+                              book.underlyings()[i]);
+        }
+    }
+}
+
+void ScenarioEngine::add(std::shared_ptr<const pricer::core::Instrument> inst,
+                         std::uint32_t underlying)
+{
+    if (!inst) {
+        throw std::runtime_error("ScenarioEngine: instrument nul");
+    }
+    if (underlying >= equities_.size()) {
+        throw std::runtime_error("ScenarioEngine: sous-jacent inconnu");
+    }
+    if (pricer::products::VanillaBook::supports(*inst)) {
+        book_.add(*inst, underlying);
+        return;
+    }
+    const auto& engine = inst->pricingEngine();
+    if (engine && !engine->clone(equities_[underlying], rates_)) {
+        throw std::runtime_error("ScenarioEngine: moteur de l'instrument non reproductible sur un marché choqué");
+    }
+    others_.push_back(Trade{std::move(inst), underlying});
+}
+
+void ScenarioEngine::add(const pricer::core::Portfolio& portfolio, std::uint32_t underlying) {
+    for (std::size_t i = 0; i < portfolio.size(); ++i) {
+        add(portfolio.sharedInstrument(i), underlying);
+    }
+}
+
+ScenarioResults ScenarioEngine::run(const ScenarioSet& scenarios, std::size_t nThreads) const {
+    using namespace pricer;
+
+    if (scenarios.underlyingCount() != equities_.size()) {
+        throw std::runtime_error("ScenarioEngine: nombre de sous-jacents différent");
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    // Scénario 0 : marché de base (chocs nuls, mêmes calculs)
+    std::size_t nU = equities_.size();
+    std::size_t nS = scenarios.size() + 1;
+    std::vector<Market> markets(nS * nU);
+    std::vector<RateShift> rateShifts(nS);
+    for (std::size_t s = 0; s < nS; ++s) {
+        if (s > 0) {
+            rateShifts[s] = scenarios.rates(s - 1);
+            if (rates_->sigma() + rateShifts[s].vol < 0.0) {
+                throw std::runtime_error("ScenarioEngine: volatilité de taux choquée négative");
+            }
+        }
+        for (std::size_t u = 0; u < nU; ++u) {
+            const auto& model = *equities_[u];
+            EquityShift shift = (s > 0) ? scenarios.equity(s - 1, u) : EquityShift{};
+            if (!(1.0 + shift.spot > 0.0)) {
+                throw std::runtime_error("ScenarioEngine: choc de spot <= -100%");
+            }
+            Market& mk = markets[s * nU + u];
+            mk.spot          = model.spot() * (1.0 + shift.spot);
+            mk.lnSpot        = std::log(mk.spot);
+            mk.rate          = model.rate() + rateShifts[s].rate;
+            mk.dividendYield = model.dividendYield() + shift.dividend;
+            mk.sigma         = model.sigma() + shift.vol;
+            if (mk.sigma < 0.0) {
+                throw std::runtime_error("ScenarioEngine: volatilité action choquée négative");
+            }
+        }
+    }
+
+    auto level = utils::detectSimdLevel();
+    TradeColumns cols = hoistTrades(book_, level);
+
+    std::size_t nBook = book_.size();
+    std::size_t nTradeBlocks    = (nBook + kTradeBlock - 1) / kTradeBlock;
+    std::size_t nScenarioBlocks = (nS + kScenarioBlock - 1) / kScenarioBlock;
+    std::size_t nOtherTasks     = others_.empty() ? 0 : nS;
+
+    // Sommes partielles par bloc de trades, réduites ensuite dans un ordre
+    // fixe : résultat indépendant du nombre de threads
+    std::vector<double> vanilla(nTradeBlocks * nS, 0.0);
+    std::vector<double> other(nS, 0.0);
+
+    // Autres instruments d'abord (les plus longs), un scénario par tâche
+    utils::parallelFor(nOtherTasks + nTradeBlocks * nScenarioBlocks, nThreads, [&](std::size_t task) {
+        utils::throwIfCancelled();
+
+        if (task < nOtherTasks) {
+            std::size_t s = task;
+            // Modèles choqués construits une fois par scénario
+            auto irCurve = std::make_shared<market::YieldCurve>(rates_->rate() + rateShifts[s].rate);
+            auto ir = std::make_shared<models::BlackIRModel>(irCurve, rates_->sigma() + rateShifts[s].vol);
+            std::vector<std::shared_ptr<models::BlackScholesModel>> bs(nU);
+            for (std::size_t u = 0; u < nU; ++u) {
+                const Market& mk = markets[s * nU + u];
+                bs[u] = std::make_shared<models::BlackScholesModel>(
+                    std::make_shared<market::YieldCurve>(mk.rate),
+                    std::make_shared<market::EquityCurve>(mk.spot, mk.dividendYield),
+                    mk.sigma);
+            }
+            // Moteur de l'instrument recopié sur ces modèles, une fois par
+            // moteur et sous-jacent ; sans moteur, celui de la fabrique
+            std::map<std::pair<const core::PricingEngine*, std::uint32_t>,
+                     std::shared_ptr<core::PricingEngine>> clones;
+            std::vector<std::unique_ptr<core::EngineFactory>> factories(nU);
+            double sum = 0.0;
+            for (const auto& trade : others_) {
+                const core::Instrument& inst = *trade.instrument;
+                std::uint32_t u = trade.underlying;
+                std::shared_ptr<core::PricingEngine> engine;
+                if (const auto& own = inst.pricingEngine()) {
+                    auto& slot = clones[{own.get(), u}];
+                    if (!slot) {
+                        slot = own->clone(bs[u], ir);
+                        if (!slot) {
+                            throw std::runtime_error("ScenarioEngine: moteur de l'instrument non reproductible sur un marché choqué");
+                        }
+                    }
+                    engine = slot;
+                } else {
+                    if (!factories[u]) {
+                        factories[u] = std::make_unique<core::EngineFactory>(bs[u], ir);
+                    }
+                    engine = factories[u]->createEngine(inst);
+                }
+                sum += engine->calculate(inst);
+            }
+            other[s] = sum;
+            return;
+        }
+
+        std::size_t tile = task - nOtherTasks;
+        std::size_t tb = tile / nScenarioBlocks;
+        std::size_t sFirst = (tile % nScenarioBlocks) * kScenarioBlock;
+        std::size_t sLast  = std::min(nS, sFirst + kScenarioBlock);
+        std::size_t last   = std::min(nBook, (tb + 1) * kTradeBlock);
+        double* partial = vanilla.data() + tb * nS;
+
+        for (std::size_t first = tb * kTradeBlock; first < last; first += kChunk) {
+            std::size_t m = std::min(kChunk, last - first);
+            for (std::size_t s = sFirst; s < sLast; ++s) {
+                partial[s] += chunkValue(book_, cols, markets.data() + s * nU, first, m, level);
+            }
+        }
+    });
+
+    std::vector<double> values(nS);
+    for (std::size_t s = 0; s < nS; ++s) {
+        double v = other[s];
+        for (std::size_t tb = 0; tb < nTradeBlocks; ++tb) {
+            v += vanilla[tb * nS + s];
+        }
+        values[s] = v;
+    }
+
+    ScenarioResults res;
+    res.baseValue = values[0];
+    res.values.assign(values.begin() + 1, values.end());
+    res.pnl.resize(res.values.size());
+    for (std::size_t s = 0; s < res.values.size(); ++s) {
+        res.pnl[s] = res.values[s] - res.baseValue;
+    }
+    res.elapsedSeconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    return res;
+}
+
+double valueAtRisk(pricer::utils::Span<const double> pnl, double confidence) {
+    if (pnl.empty()) {
+        throw std::runtime_error("valueAtRisk: aucun scénario");
+    }
+    if (!(confidence > 0.0 && confidence < 1.0)) {
+        throw std::runtime_error("valueAtRisk: niveau de confiance hors de ]0, 1[");
+    }
+    // Tolérance : 500 x (1 - 0.99) ne doit pas donner 6
+    double tail = static_cast<double>(pnl.size()) * (1.0 - confidence);
+    std::size_t k = static_cast<std::size_t>(std::ceil(tail - 1e-9));
+    k = std::clamp<std::size_t>(k, 1, pnl.size());
+
+    std::vector<double> sorted(pnl.begin(), pnl.end());
+    std::nth_element(sorted.begin(), sorted.begin() + (k - 1), sorted.end());
+    return -sorted[k - 1];
+}
+
+} 
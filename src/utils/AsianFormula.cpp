@@ -0,0 +1,258 @@
+#include "utils/AsianFormula.hpp"
+
+#include "utils/BlackFormula.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace pricer::utils {
+
+namespace {
+
+using pricer::core::OptionType;
+
+double intrinsic(double A, double K, OptionType type) {
+    return (type == OptionType::Call) ? std::max(A - K, 0.0) : std::max(K - A, 0.0);
+}
+
+// integrale de exp(a u) sur [t1, t2], stable pour a proche de 0
+double expIntegral(double a, double t1, double t2) {
+    double tau = t2 - t1;
+    if (std::abs(a * tau) < 1e-12) {
+        return std::exp(a * t1) * tau;
+    }
+    return std::exp(a * t1) * std::expm1(a * tau) / a;
+}
+
+// Strike effectif des fixings futurs et poids de leur moyenne dans la
+// moyenne totale. Pour un call à strike effectif négatif ou nul, l'option
+// est sûrement exercée : on renvoie alors directement le prix forward.
+struct Seasoning {
+    double kStar;
+    double weight;
+    double pastSum;
+    double n;
+};
+
+Seasoning season(double K, std::size_t k, const std::vector<double>& pastFixings) {
+    Seasoning s;
+    s.pastSum = 0.0;
+    for (double f : pastFixings) s.pastSum += f;
+    s.n      = static_cast<double>(pastFixings.size() + k);
+    s.kStar  = (s.n * K - s.pastSum) / static_cast<double>(k);
+    s.weight = static_cast<double>(k) / s.n;
+    return s;
+}
+
+void checkInputs(const char* name, const std::vector<double>& fixingTimes,
+                 const std::vector<double>& pastFixings)
+{
+    if (fixingTimes.empty() && pastFixings.empty()) {
+        throw std::runtime_error(std::string(name) + ": aucune date de fixing");
+    }
+    for (std::size_t i = 0; i < fixingTimes.size(); ++i) {
+        if (fixingTimes[i] <= 0.0 || (i > 0 && fixingTimes[i] <= fixingTimes[i - 1])) {
+            throw std::runtime_error(std::string(name) + ": dates de fixing non croissantes");
+        }
+    }
+}
+
+// Moyenne arithmétique : traitement commun de la partie constatée.
+// futurePrice(kStar) donne le prix non actualisé sur la moyenne des
+// fixings futurs, forwardMean leur espérance.
+template <class Price>
+double seasonedArithmetic(double K, const std::vector<double>& fixingTimes,
+                          const std::vector<double>& pastFixings,
+                          OptionType type, double forwardMean, Price&& futurePrice)
+{
+    std::size_t k = fixingTimes.size();
+    if (k == 0) {
+        double sum = 0.0;
+        for (double f : pastFixings) sum += f;
+        return intrinsic(sum / static_cast<double>(pastFixings.size()), K, type);
+    }
+
+    Seasoning s = season(K, k, pastFixings);
+    if (s.kStar <= 0.0) {
+        // moyenne déjà au-dessus du strike quoi qu'il arrive
+        return (type == OptionType::Call) ? s.weight * (forwardMean - s.kStar) : 0.0;
+    }
+    return s.weight * futurePrice(s.kStar);
+}
+
+// Forwards F_i et deux premiers moments de la moyenne discrète des fixings
+void discreteMoments(double S0, double b, double sigma,
+                     const std::vector<double>& t, double& M1, double& M2)
+{
+    std::size_t k = t.size();
+    std::vector<double> F(k);
+    for (std::size_t i = 0; i < k; ++i) F[i] = S0 * std::exp(b * t[i]);
+
+    // E[S_i S_j] = F_i F_j exp(sigma^2 min(t_i, t_j)) : sommes suffixes, O(k)
+    double sumF = 0.0, m2 = 0.0, suffix = 0.0;
+    for (std::size_t i = k; i-- > 0;) {
+        m2     += F[i] * std::exp(sigma * sigma * t[i]) * (F[i] + 2.0 * suffix);
+        suffix += F[i];
+    }
+    sumF = suffix;
+
+    double kk = static_cast<double>(k);
+    M1 = sumF / kk;
+    M2 = m2 / (kk * kk);
+}
+
+double lognormalMatch(double M1, double M2, double K, OptionType type) {
+    double variance = std::log(M2 / (M1 * M1));
+    return blackForward(M1, K, std::sqrt(std::max(variance, 0.0)), type);
+}
+
+} 
+
+double geometricAsianUndiscounted(double S0, double K,
+                                  double r, double q, double sigma,
+                                  const std::vector<double>& fixingTimes,
+                                  pricer::core::OptionType type,
+                                  const std::vector<double>& pastFixings)
+{
+    checkInputs("geometricAsianUndiscounted", fixingTimes, pastFixings);
+
+    std::vector<double> t(fixingTimes);
+    std::sort(t.begin(), t.end());
+
+    std::size_t k = t.size();
+    double n = static_cast<double>(k + pastFixings.size());
+
+    double sumLogPast = 0.0;
+    for (double f : pastFixings) sumLogPast += std::log(f);
+
+    double sumT = 0.0;
+    double sumMin = 0.0;  // sum_i sum_j min(t_i, t_j)
+    for (std::size_t i = 0; i < k; ++i) {
+        sumT   += t[i];
+        sumMin += t[i] * static_cast<double>(2 * (k - i) - 1);
+    }
+
+    double mean = (sumLogPast + static_cast<double>(k) * std::log(S0)
+                   + (r - q - 0.5 * sigma * sigma) * sumT) / n;
+    double variance = sigma * sigma * sumMin / (n * n);
+    if (k == 0) {
+        return intrinsic(std::exp(mean), K, type);
+    }
+
+    double stdDev  = std::sqrt(variance);
+    double forward = std::exp(mean + 0.5 * variance);
+    return blackForward(forward, K, stdDev, type);
+}
+
+double levyAsianUndiscounted(double S0, double K,
+                             double r, double q, double sigma,
+                             const std::vector<double>& fixingTimes,
+                             pricer::core::OptionType type,
+                             const std::vector<double>& pastFixings)
+{
+    checkInputs("levyAsianUndiscounted", fixingTimes, pastFixings);
+
+    double M1 = 0.0, M2 = 0.0;
+    if (!fixingTimes.empty()) discreteMoments(S0, r - q, sigma, fixingTimes, M1, M2);
+
+    return seasonedArithmetic(K, fixingTimes, pastFixings, type, M1, [&](double kStar) {
+        return lognormalMatch(M1, M2, kStar, type);
+    });
+}
+
+double turnbullWakemanAsianUndiscounted(double S0, double K,
+                                        double r, double q, double sigma,
+                                        const std::vector<double>& fixingTimes,
+                                        pricer::core::OptionType type,
+                                        const std::vector<double>& pastFixings)
+{
+    checkInputs("turnbullWakemanAsianUndiscounted", fixingTimes, pastFixings);
+
+    double M1 = 0.0, M2 = 0.0;
+    if (fixingTimes.size() == 1) {
+        discreteMoments(S0, r - q, sigma, fixingTimes, M1, M2);
+    } else if (!fixingTimes.empty()) {
+        // Moments de (1/tau) * integrale de S(u) sur [t1, t2]
+        double b   = r - q;
+        double v2  = sigma * sigma;
+        double t1  = fixingTimes.front();
+        double t2  = fixingTimes.back();
+        double tau = t2 - t1;
+        double c   = b + v2;
+        if (std::abs(c) < 1e-8) c = (c < 0.0 ? -1e-8 : 1e-8);
+
+        M1 = S0 * expIntegral(b, t1, t2) / tau;
+        M2 = 2.0 * S0 * S0 / (tau * tau)
+           * (expIntegral(2.0 * b + v2, t1, t2) - std::exp(c * t1) * expIntegral(b, t1, t2)) / c;
+    }
+
+    return seasonedArithmetic(K, fixingTimes, pastFixings, type, M1, [&](double kStar) {
+        return lognormalMatch(M1, M2, kStar, type);
+    });
+}
+
+double curranAsianUndiscounted(double S0, double K,
+                               double r, double q, double sigma,
+                               const std::vector<double>& fixingTimes,
+                               pricer::core::OptionType type,
+                               const std::vector<double>& pastFixings)
+{
+    checkInputs("curranAsianUndiscounted", fixingTimes, pastFixings);
+
+    const std::vector<double>& t = fixingTimes;
+    std::size_t k = t.size();
+    double kk = static_cast<double>(k);
+    double b  = r - q;
+    double v2 = sigma * sigma;
+
+    double M1 = 0.0;
+    for (double ti : t) M1 += S0 * std::exp(b * ti);
+    if (k > 0) M1 /= kk;
+
+    return seasonedArithmetic(K, fixingTimes, pastFixings, type, M1, [&](double kStar) {
+        // ln S_i ~ N(mu_i, sigma^2 t_i) ; G = moyenne des ln S_i
+        // cov(ln S_i, G) = sigma^2 / k * sum_j min(t_i, t_j)
+        double sumT = 0.0, sumMin = 0.0;
+        for (std::size_t i = 0; i < k; ++i) {
+            sumT   += t[i];
+            sumMin += t[i] * static_cast<double>(2 * (k - i) - 1);
+        }
+        double muG  = std::log(S0) + (b - 0.5 * v2) * sumT / kk;
+        double varG = v2 * sumMin / (kk * kk);
+        double sdG  = std::sqrt(varG);
+        double lnK  = std::log(kStar);
+
+        std::vector<double> mu(k), covXG(k);
+        double prefix = 0.0;  // somme des t_j pour j < i
+        for (std::size_t i = 0; i < k; ++i) {
+            mu[i]    = std::log(S0) + (b - 0.5 * v2) * t[i];
+            covXG[i] = v2 * (prefix + t[i] * static_cast<double>(k - i)) / kk;
+            prefix  += t[i];
+        }
+
+        // Strike ajusté : E[A | G = ln K] = K définit la frontière
+        double kHat = 2.0 * kStar;
+        for (std::size_t i = 0; i < k; ++i) {
+            kHat -= std::exp(mu[i] + covXG[i] * (lnK - muG) / varG
+                             + 0.5 * (v2 * t[i] - covXG[i] * covXG[i] / varG)) / kk;
+        }
+        if (kHat <= 0.0) {
+            // hors du domaine de l'approximation : repli sur Levy
+            double L1 = 0.0, L2 = 0.0;
+            discreteMoments(S0, b, sigma, t, L1, L2);
+            return lognormalMatch(L1, L2, kStar, type);
+        }
+
+        double d = (muG - std::log(kHat)) / sdG;
+        double call = -kStar * normalCdf(d);
+        for (std::size_t i = 0; i < k; ++i) {
+            call += std::exp(mu[i] + 0.5 * v2 * t[i]) * normalCdf(d + covXG[i] / sdG) / kk;
+        }
+        // parité call-put sur la moyenne des fixings futurs
+        return (type == OptionType::Call) ? call : call - (M1 - kStar);
+    });
+}
+
+} 
@@ -2,6 +2,8 @@
 
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include <stdexcept>
 
 namespace pricer::utils {
 
@@ -9,6 +11,53 @@ double normalCdf(double x) {
     return 0.5 * std::erfc(-x / std::sqrt(2.0));
 }
 
+double inverseNormalCdf(double p) {
+    static const double a[] = {
+        -3.969683028665376e+01,  2.209460984245205e+02, -2.759285104469687e+02,
+         1.383577518672690e+02, -3.066479806614716e+01,  2.506628277459239e+00
+    };
+    static const double b[] = {
+        -5.447609879822406e+01,  1.615858368580409e+02, -1.556989798598866e+02,
+         6.680131188771972e+01, -1.328068155288572e+01
+    };
+    static const double c[] = {
+        -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+        -2.549732539343734e+00,  4.374664141464968e+00,  2.938163982698783e+00
+    };
+    static const double d[] = {
+         7.784695709041462e-03,  3.224671290700398e-01,  2.445134137142996e+00,
+         3.754408661907416e+00
+    };
+    const double pLow = 0.02425;
+    const double sqrt2Pi = 2.50662827463100050242;
+
+    if (p <= 0.0) return -HUGE_VAL;
+    if (p >= 1.0) return HUGE_VAL;
+
+    double x;
+    if (p < pLow) {
+        double q = std::sqrt(-2.0 * std::log(p));
+        x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    } else if (p <= 1.0 - pLow) {
+        double q = p - 0.5;
+        double r = q * q;
+        x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+            (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+    } else {
+        double q = std::sqrt(-2.0 * std::log(1.0 - p));
+        x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+             ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+
+    // Raffinement de Halley : précision relative ~1e-15
+    double e = normalCdf(x) - p;
+    double u = e * sqrt2Pi * std::exp(0.5 * x * x);
+    x = x - u / (1.0 + 0.5 * x * u);
+
+    return x;
+}
+
 double blackForward(double F, double K, double stdDev,
                     pricer::core::OptionType type)
 {
@@ -26,15 +75,70 @@ double blackForward(double F, double K, double stdDev,
     double d1 = (lnFK + 0.5 * stdDev * stdDev) / stdDev;
     double d2 = d1 - stdDev;
 
-    double Nd1  = normalCdf(d1);
-    double Nd2  = normalCdf(d2);
-    double Nmd1 = normalCdf(-d1);
-    double Nmd2 = normalCdf(-d2);
+    // call : F N(d1) - K N(d2) ; put : K N(-d2) - F N(-d1)
+    double phi = (type == pricer::core::OptionType::Call) ? 1.0 : -1.0;
+    return phi * (F * normalCdf(phi * d1) - K * normalCdf(phi * d2));
+}
 
-    if (type == pricer::core::OptionType::Call) {
-        return F * Nd1 - K * Nd2;
-    } else {
-        return K * Nmd2 - F * Nmd1;
+void blackForwardBatch(Span<const double> forwards,
+                       Span<const double> strikes,
+                       Span<const double> stdDevs,
+                       Span<const pricer::core::OptionType> types,
+                       Span<const double> discounts,
+                       Span<double> out)
+{
+    blackForwardBatch(forwards, strikes, stdDevs, types, discounts, out, detectSimdLevel());
+}
+
+void blackForwardBatch(Span<const double> forwards,
+                       Span<const double> strikes,
+                       Span<const double> stdDevs,
+                       Span<const pricer::core::OptionType> types,
+                       Span<const double> discounts,
+                       Span<double> out,
+                       SimdLevel level)
+{
+    std::size_t n = out.size();
+    if (forwards.size() != n || strikes.size() != n || stdDevs.size() != n
+        || types.size() != n || discounts.size() != n) {
+        throw std::runtime_error("blackForwardBatch: tableaux de tailles différentes");
+    }
+
+    // Traitement par paquets tenant en L1 : d1 dans d[0, m), d2 dans
+    // d[m, 2m), pour un seul appel à vnormalCdf
+    constexpr std::size_t chunk = 256;
+    double lnFK[chunk];
+    double d[2 * chunk];
+    double N[2 * chunk];
+    double phi[chunk];
+
+    for (std::size_t first = 0; first < n; first += chunk) {
+        std::size_t m = std::min(chunk, n - first);
+        const double* F  = forwards.data() + first;
+        const double* K  = strikes.data() + first;
+        const double* sd = stdDevs.data() + first;
+
+        for (std::size_t i = 0; i < m; ++i) lnFK[i] = F[i] / K[i];
+        vlog(lnFK, lnFK, m, level);
+
+        for (std::size_t i = 0; i < m; ++i) {
+            double s  = (sd[i] > 0.0) ? sd[i] : 1.0;
+            double d1 = (lnFK[i] + 0.5 * s * s) / s;
+            double d2 = d1 - s;
+            phi[i]       = (types[first + i] == pricer::core::OptionType::Call) ? 1.0 : -1.0;
+            d[i]     = phi[i] * d1;
+            d[m + i] = phi[i] * d2;
+        }
+        vnormalCdf(d, N, 2 * m, level);
+
+        for (std::size_t i = 0; i < m; ++i) {
+            std::size_t j = first + i;
+            if (sd[i] > 0.0 && F[i] > 0.0 && K[i] > 0.0) {
+                out[j] = discounts[j] * phi[i] * (F[i] * N[i] - K[i] * N[m + i]);
+            } else {
+                out[j] = discounts[j] * blackForward(F[i], K[i], sd[i], types[j]);
+            }
+        }
     }
 }
 
@@ -63,4 +167,244 @@ double blackDigitalForward(double F, double K, double stdDev,
     }
 }
 
-} // namespace pricer::utils
+namespace {
+
+constexpr double kInvSqrt2Pi = 0.39894228040143267794;
+constexpr double kTwoPi      = 6.28318530717958647693;
+
+} 
+
+BlackSensitivities blackForwardSensitivities(double F, double K, double stdDev,
+                                             pricer::core::OptionType type)
+{
+    double phi = (type == pricer::core::OptionType::Call) ? 1.0 : -1.0;
+
+    BlackSensitivities out;
+    if (stdDev <= 0.0) {
+        // limite : intrinsèque, vega F n(0) à la monnaie seulement
+        bool inTheMoney = phi * (F - K) > 0.0;
+        out.value    = inTheMoney ? phi * (F - K) : 0.0;
+        out.dForward = inTheMoney ? phi : 0.0;
+        out.dStdDev  = (F == K) ? F * kInvSqrt2Pi : 0.0;
+        return out;
+    }
+
+    double d1 = (std::log(F / K) + 0.5 * stdDev * stdDev) / stdDev;
+    double d2 = d1 - stdDev;
+    double n1 = kInvSqrt2Pi * std::exp(-0.5 * d1 * d1);
+    double N1 = normalCdf(phi * d1);
+    double N2 = normalCdf(phi * d2);
+
+    out.value     = phi * (F * N1 - K * N2);
+    out.dForward  = phi * N1;
+    out.dForward2 = n1 / (F * stdDev);
+    out.dStdDev   = F * n1;
+    return out;
+}
+
+BlackSensitivities blackDigitalForwardSensitivities(double F, double K, double stdDev,
+                                                    pricer::core::OptionType type,
+                                                    double payout)
+{
+    double phi = (type == pricer::core::OptionType::Call) ? 1.0 : -1.0;
+
+    BlackSensitivities out;
+    if (stdDev <= 0.0) {
+        out.value = (phi * (F - K) > 0.0) ? payout : 0.0;
+        return out;
+    }
+
+    double d1 = (std::log(F / K) + 0.5 * stdDev * stdDev) / stdDev;
+    double d2 = d1 - stdDev;
+    double n2 = kInvSqrt2Pi * std::exp(-0.5 * d2 * d2);
+
+    // V = Q N(phi d2), d2 dépend de F en 1/(F s) et de s en -d1/s
+    out.value     = payout * normalCdf(phi * d2);
+    out.dForward  = phi * payout * n2 / (F * stdDev);
+    out.dForward2 = -phi * payout * n2 * d1 / (F * F * stdDev * stdDev);
+    out.dStdDev   = -phi * payout * n2 * d1 / stdDev;
+    return out;
+}
+
+namespace {
+
+// Prix de Black normalisé d'un call hors de la monnaie, x = ln(F/K) <= 0,
+// s = stdDev : b(x, s) = e^{x/2} N(x/s + s/2) - e^{-x/2} N(x/s - s/2)
+double normalisedCall(double x, double s) {
+    if (s <= 0.0) return 0.0;
+    double h = x / s;
+    double t = 0.5 * s;
+    if (h + t < 0.0) {
+        // Sous le point d'inflexion les deux termes sont petits et proches :
+        // on factorise exp(-(h^2 + t^2) / 2), commun aux deux, et on
+        // soustrait les erfcx, sans amplification par l'exponentielle
+        const double invSqrt2 = 0.70710678118654752440;
+        return 0.5 * std::exp(-0.5 * (h * h + t * t))
+             * (erfcx(-(h + t) * invSqrt2) - erfcx(-(h - t) * invSqrt2));
+    }
+    return std::exp(0.5 * x) * normalCdf(h + t) - std::exp(-0.5 * x) * normalCdf(h - t);
+}
+
+// e^{x/2} - b(x, s), sans annulation quand b approche sa borne
+double normalisedCallGap(double x, double s) {
+    double h = x / s;
+    double t = 0.5 * s;
+    return std::exp(0.5 * x) * normalCdf(-h - t) + std::exp(-0.5 * x) * normalCdf(h - t);
+}
+
+// Vega normalisée db/ds
+double normalisedVega(double x, double s) {
+    double h = x / s;
+    double t = 0.5 * s;
+    return kInvSqrt2Pi * std::exp(-0.5 * (h * h + t * t));
+}
+
+// Inversion de b(x, .) = beta pour x <= 0 et 0 < beta < e^{x/2}.
+// Découpage de Jäckel ("Let's Be Rational") autour du point d'inflexion
+// s_c = sqrt(2|x|) : objectif 1/ln(b) dans la zone basse, b au milieu,
+// -ln(e^{x/2} - b) dans la zone haute, chacun quasi linéaire en s. Le
+// point de départ vient des formes asymptotiques de chaque zone, puis
+// des pas de Householder d'ordre 3.
+double impliedNormalisedStdDev(double x, double beta) {
+    // A la monnaie, b(0, s) = 2 N(s/2) - 1 s'inverse exactement (s_c = 0,
+    // le découpage en zones n'a pas de sens). Pour beta petit, 1 - beta
+    // perd des chiffres : un pas de Newton sur erf(s / (2 sqrt 2)) = beta
+    // les retrouve.
+    if (x == 0.0) {
+        double s = -2.0 * inverseNormalCdf(0.5 * (1.0 - beta));
+        if (beta < 0.5) {
+            s -= (std::erf(0.35355339059327376220 * s) - beta) / (kInvSqrt2Pi * std::exp(-0.125 * s * s));
+        }
+        return s;
+    }
+
+    double bMax = std::exp(0.5 * x);
+    double ax   = std::abs(x);
+
+    double sC = std::sqrt(2.0 * ax);
+    double bC = normalisedCall(x, sC);
+    double vC = normalisedVega(x, sC);
+
+    double sL = sC - bC / vC;
+    double bL = (sL > 0.0) ? normalisedCall(x, sL) : 0.0;
+    double sU = sC + (bMax - bC) / vC;
+    double bU = normalisedCall(x, sU);
+
+    enum class Zone { Lower, Middle, Upper };
+    Zone zone;
+    double s;
+    if (beta < bL) {
+        // b ~ 2 pi |x| / (3 sqrt 3) N(-|x| / (sqrt 3 s))^3
+        zone = Zone::Lower;
+        double u = std::cbrt(beta * 3.0 * std::sqrt(3.0) / (kTwoPi * ax));
+        s = -ax / (std::sqrt(3.0) * inverseNormalCdf(u));
+    } else if (beta <= bU) {
+        zone = Zone::Middle;
+        s = sC + (beta - bC) / vC;
+    } else {
+        // e^{x/2} - b ~ (e^{x/2} + e^{-x/2}) N(-s/2)
+        zone = Zone::Upper;
+        s = -2.0 * inverseNormalCdf((bMax - beta) / (bMax + 1.0 / bMax));
+    }
+
+    double lnBeta  = std::log(beta);
+    double gapBeta = bMax - beta;
+
+    // Convergence cubique : on s'arrête à la précision machine ou dès que
+    // les pas cessent de décroître (bruit d'arrondi de b)
+    double lastStep = std::numeric_limits<double>::infinity();
+    for (int iter = 0; iter < 12; ++iter) {
+        double v  = normalisedVega(x, s);
+        double r2 = x * x / (s * s * s) - 0.25 * s;
+        double r3 = r2 * r2 - 3.0 * x * x / (s * s * s * s) - 0.25;
+
+        double nu, h2, h3;
+        if (zone == Zone::Lower) {
+            // b peut être très petit : on travaille sur q = v / b
+            double b = normalisedCall(x, s);
+            double L = std::log(b);
+            double q = v / b;
+            nu = (1.0 / L - 1.0 / lnBeta) * L * L / q;
+            double g2 = -(L + 2.0) / L * q;
+            double g3 = (2.0 * L * L + 6.0 * L + 6.0) / (L * L) * q * q;
+            h2 = g2 + r2;
+            h3 = g3 + 3.0 * g2 * r2 + r3;
+        } else if (zone == Zone::Middle) {
+            nu = (beta - normalisedCall(x, s)) / v;
+            h2 = r2;
+            h3 = r3;
+        } else {
+            double gap = normalisedCallGap(x, s);
+            nu = -std::log(gapBeta / gap) * gap / v;
+            h2 = v / gap + r2;
+            h3 = 2.0 * v * v / (gap * gap) + 3.0 * v * r2 / gap + r3;
+        }
+
+        double step = nu * (1.0 + 0.5 * h2 * nu) / (1.0 + nu * (h2 + h3 * nu / 6.0));
+        if (!std::isfinite(step)) break;
+        double next = (s + step > 0.0) ? s + step : 0.5 * s;
+        double absStep = std::abs(next - s);
+        bool done = absStep <= 4.0 * std::numeric_limits<double>::epsilon() * next
+                 || absStep >= 0.5 * lastStep;
+        s = next;
+        lastStep = absStep;
+        if (done) break;
+    }
+    return s;
+}
+
+} 
+
+double impliedBlackStdDev(double price, double F, double K,
+                          pricer::core::OptionType type)
+{
+    if (!(F > 0.0) || !(K > 0.0)) {
+        throw std::runtime_error("impliedBlackStdDev: forward et strike doivent être positifs");
+    }
+
+    // Normalisation par sqrt(F K) ; valeur temps ramenée à un call hors
+    // de la monnaie (x <= 0) par parité et symétrie
+    double x     = std::log(F / K);
+    double scale = std::sqrt(F * K);
+    double theta = (type == pricer::core::OptionType::Call) ? 1.0 : -1.0;
+
+    double beta      = price / scale;
+    double intrinsic = std::max(theta * (std::exp(0.5 * x) - std::exp(-0.5 * x)), 0.0);
+    double upper     = (theta > 0.0) ? std::exp(0.5 * x) : std::exp(-0.5 * x);
+
+    // tolérance d'arrondi : un prix calculé à l'intrinsèque peut tomber
+    // quelques ulps (à l'échelle du forward) sous la borne
+    double tolerance = 8.0 * std::numeric_limits<double>::epsilon() * upper;
+    if (!(beta >= intrinsic - tolerance) || !(beta < upper)) {
+        throw std::runtime_error("impliedBlackStdDev: prix hors des bornes d'arbitrage");
+    }
+    double timeValue = beta - intrinsic;
+    if (timeValue <= 0.0) {
+        return 0.0;
+    }
+    return impliedNormalisedStdDev(-std::abs(x), timeValue);
+}
+
+void impliedBlackStdDevBatch(Span<const double> prices,
+                             Span<const double> forwards,
+                             Span<const double> strikes,
+                             Span<const pricer::core::OptionType> types,
+                             Span<const double> discounts,
+                             Span<double> out)
+{
+    std::size_t n = out.size();
+    if (prices.size() != n || forwards.size() != n || strikes.size() != n
+        || types.size() != n || discounts.size() != n) {
+        throw std::runtime_error("impliedBlackStdDevBatch: tableaux de tailles différentes");
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        try {
+            out[i] = impliedBlackStdDev(prices[i] / discounts[i], forwards[i], strikes[i], types[i]);
+        } catch (const std::runtime_error&) {
+            out[i] = std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+}
+
+} 
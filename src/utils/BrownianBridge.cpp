@@ -0,0 +1,101 @@
+#include "utils/BrownianBridge.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace pricer::utils {
+
+BrownianBridge::BrownianBridge(std::size_t nSteps)
+    : times_(nSteps)
+{
+    for (std::size_t i = 0; i < nSteps; ++i) {
+        times_[i] = static_cast<double>(i + 1) / static_cast<double>(nSteps);
+    }
+    init();
+}
+
+BrownianBridge::BrownianBridge(std::vector<double> times)
+    : times_(std::move(times))
+{
+    init();
+}
+
+void BrownianBridge::init() {
+    std::size_t n = times_.size();
+    if (n == 0) {
+        throw std::runtime_error("BrownianBridge: grille vide");
+    }
+
+    sqrtdt_.resize(n);
+    double prev = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (times_[i] <= prev) {
+            throw std::runtime_error("BrownianBridge: grille non strictement croissante");
+        }
+        sqrtdt_[i] = std::sqrt(times_[i] - prev);
+        prev = times_[i];
+    }
+
+    bridgeIndex_.assign(n, 0);
+    leftIndex_.assign(n, 0);
+    rightIndex_.assign(n, 0);
+    leftWeight_.assign(n, 0.0);
+    rightWeight_.assign(n, 0.0);
+    stdDev_.assign(n, 0.0);
+
+    const auto& t = times_;
+
+    // map[i] != 0 : point i déjà construit
+    std::vector<std::size_t> map(n, 0);
+    map[n - 1] = 1;
+    bridgeIndex_[0] = n - 1;
+    stdDev_[0] = std::sqrt(t[n - 1]);
+
+    for (std::size_t j = 0, i = 1; i < n; ++i) {
+        while (map[j]) ++j;
+        std::size_t k = j;
+        while (!map[k]) ++k;
+        // points j..k-1 libres, k construit : on insère le milieu l
+        std::size_t l = j + ((k - 1 - j) >> 1);
+        map[l] = i;
+        bridgeIndex_[i] = l;
+        leftIndex_[i]   = j;
+        rightIndex_[i]  = k;
+        if (j != 0) {
+            double span = t[k] - t[j - 1];
+            leftWeight_[i]  = (t[k] - t[l]) / span;
+            rightWeight_[i] = (t[l] - t[j - 1]) / span;
+            stdDev_[i] = std::sqrt((t[l] - t[j - 1]) * (t[k] - t[l]) / span);
+        } else {
+            leftWeight_[i]  = (t[k] - t[l]) / t[k];
+            rightWeight_[i] = t[l] / t[k];
+            stdDev_[i] = std::sqrt(t[l] * (t[k] - t[l]) / t[k]);
+        }
+        j = k + 1;
+        if (j >= n) j = 0;
+    }
+}
+
+void BrownianBridge::transform(const double* z, double* out) const {
+    std::size_t n = times_.size();
+    double* w = out; // le chemin W(t_i) est construit en place
+
+    w[n - 1] = stdDev_[0] * z[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        std::size_t j = leftIndex_[i];
+        std::size_t k = rightIndex_[i];
+        std::size_t l = bridgeIndex_[i];
+        if (j != 0) {
+            w[l] = leftWeight_[i] * w[j - 1] + rightWeight_[i] * w[k] + stdDev_[i] * z[i];
+        } else {
+            w[l] = rightWeight_[i] * w[k] + stdDev_[i] * z[i];
+        }
+    }
+
+    for (std::size_t i = n - 1; i > 0; --i) {
+        out[i] = (w[i] - w[i - 1]) / sqrtdt_[i];
+    }
+    out[0] = w[0] / sqrtdt_[0];
+}
+
+} 
@@ -0,0 +1,31 @@
+#include "utils/Cancellation.hpp"
+
+namespace pricer::utils {
+
+namespace {
+
+thread_local const CancellationToken* tlsToken = nullptr;
+
+} 
+
+const CancellationToken* currentCancellation() {
+    return tlsToken;
+}
+
+void throwIfCancelled() {
+    if (tlsToken && tlsToken->cancelled()) {
+        throw OperationCancelled();
+    }
+}
+
+CancellationScope::CancellationScope(const CancellationToken* token)
+    : previous_(tlsToken)
+{
+    tlsToken = token;
+}
+
+CancellationScope::~CancellationScope() {
+    tlsToken = previous_;
+}
+
+} 
@@ -0,0 +1,86 @@
+#include "utils/Normal.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace pricer::utils {
+
+namespace {
+
+constexpr int zigLayers = 128;
+constexpr double zigR = 3.442619855899;           // abscisse de la dernière couche
+constexpr double zigV = 9.91256303526217e-3;      // aire commune des couches
+
+struct ZigguratTables {
+    double x[zigLayers + 1];
+    double ratio[zigLayers];
+
+    ZigguratTables() {
+        double f = std::exp(-0.5 * zigR * zigR);
+        x[0] = zigV / f;  // base : rectangle + queue
+        x[1] = zigR;
+        x[zigLayers] = 0.0;
+        for (int i = 2; i < zigLayers; ++i) {
+            x[i] = std::sqrt(-2.0 * std::log(zigV / x[i - 1] + f));
+            f = std::exp(-0.5 * x[i] * x[i]);
+        }
+        for (int i = 0; i < zigLayers; ++i) {
+            ratio[i] = x[i + 1] / x[i];
+        }
+    }
+};
+
+const ZigguratTables& tables() {
+    static const ZigguratTables t;
+    return t;
+}
+
+// Uniforme dans ]0,1[ sur 53 bits
+inline double uniform01(std::mt19937_64& gen) {
+    return (static_cast<double>(gen() >> 11) + 0.5) * 0x1.0p-53;
+}
+
+// Queue au-delà de R (Marsaglia, 1964)
+double tail(std::mt19937_64& gen, bool negative) {
+    double x, y;
+    do {
+        x = std::log(uniform01(gen)) / zigR;
+        y = std::log(uniform01(gen));
+    } while (-2.0 * y < x * x);
+    return negative ? x - zigR : zigR - x;
+}
+
+} 
+
+double ZigguratNormal::operator()(std::mt19937_64& gen) const {
+    const ZigguratTables& t = tables();
+    for (;;) {
+        // 7 bits de poids faible : couche ; 53 bits de poids fort : u dans ]-1,1[
+        std::uint64_t bits = gen();
+        int i = static_cast<int>(bits & (zigLayers - 1));
+        double u = 2.0 * ((static_cast<double>(bits >> 11) + 0.5) * 0x1.0p-53) - 1.0;
+
+        if (std::abs(u) < t.ratio[i]) {
+            return u * t.x[i];
+        }
+        if (i == 0) {
+            return tail(gen, u < 0.0);
+        }
+
+        // Coin de la couche : test sous la densité
+        double x  = u * t.x[i];
+        double f0 = std::exp(-0.5 * (t.x[i] * t.x[i] - x * x));
+        double f1 = std::exp(-0.5 * (t.x[i + 1] * t.x[i + 1] - x * x));
+        if (f1 + uniform01(gen) * (f0 - f1) < 1.0) {
+            return x;
+        }
+    }
+}
+
+void ZigguratNormal::fill(std::mt19937_64& gen, double* out, std::size_t n) const {
+    for (std::size_t k = 0; k < n; ++k) {
+        out[k] = (*this)(gen);
+    }
+}
+
+} 
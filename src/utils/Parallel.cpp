@@ -0,0 +1,112 @@
+#include "utils/Parallel.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/Cancellation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace pricer::utils {
+
+namespace {
+
+// État partagé d'une boucle : les tâches auxiliaires encore en file quand
+// l'appelant a fini (tous les indices distribués) n'y touchent plus.
+struct LoopState {
+    std::atomic<std::size_t> next{0};
+    std::size_t n = 0;
+    const std::function<void(std::size_t)>* fn = nullptr;
+    const CancellationToken* token = nullptr;  // celui de l'appelant
+
+    std::mutex mutex;
+    std::condition_variable idle;
+    std::size_t active = 0;
+    bool closed = false;
+    std::exception_ptr error;
+
+    void run() {
+        for (;;) {
+            std::size_t i = next.fetch_add(1);
+            if (i >= n) {
+                return;
+            }
+            try {
+                (*fn)(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next.store(n); // on arrête la distribution des indices
+            }
+        }
+    }
+};
+
+} 
+
+std::size_t resolveThreadCount(std::size_t nThreads) {
+    if (nThreads == 0) {
+        nThreads = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(nThreads, 1);
+}
+
+void parallelFor(std::size_t n, std::size_t nThreads,
+                 const std::function<void(std::size_t)>& fn)
+{
+    std::size_t nWorkers = std::min(resolveThreadCount(nThreads), n);
+
+    if (nWorkers <= 1) {
+        for (std::size_t i = 0; i < n; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    ThreadPool* pool = ThreadPool::current();
+    if (!pool) {
+        pool = &defaultThreadPool();
+    }
+
+    auto state = std::make_shared<LoopState>();
+    state->n     = n;
+    state->fn    = &fn;
+    state->token = currentCancellation();
+
+    // nWorkers - 1 tâches auxiliaires : dans la file du thread appelant
+    // s'il appartient au pool, où les threads inactifs viennent les voler
+    for (std::size_t t = 1; t < nWorkers; ++t) {
+        pool->post([state] {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->closed) return;
+                ++state->active;
+            }
+            {
+                CancellationScope scope(state->token);
+                state->run();
+            }
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (--state->active == 0) {
+                state->idle.notify_all();
+            }
+        });
+    }
+
+    // L'appelant participe, puis n'attend que les tâches déjà démarrées
+    state->run();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->closed = true;
+    state->idle.wait(lock, [&] { return state->active == 0; });
+
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+} 
@@ -0,0 +1,108 @@
+#include "utils/Philox.hpp"
+
+namespace pricer::utils {
+
+namespace {
+
+constexpr std::uint32_t philoxM0 = 0xD2511F53u;
+constexpr std::uint32_t philoxM1 = 0xCD9E8D57u;
+constexpr std::uint32_t philoxW0 = 0x9E3779B9u;  // nombre d'or
+constexpr std::uint32_t philoxW1 = 0xBB67AE85u;  // sqrt(3) - 1
+
+inline void mulHiLo(std::uint32_t a, std::uint32_t b,
+                    std::uint32_t& hi, std::uint32_t& lo)
+{
+    std::uint64_t prod = static_cast<std::uint64_t>(a) * b;
+    hi = static_cast<std::uint32_t>(prod >> 32);
+    lo = static_cast<std::uint32_t>(prod);
+}
+
+// 53 bits de poids fort centrés dans leur intervalle : jamais 0 ni 1
+inline double toUniform(std::uint32_t hi, std::uint32_t lo) {
+    std::uint64_t bits = ((static_cast<std::uint64_t>(hi) << 32) | lo) >> 11;
+    return (static_cast<double>(bits) + 0.5) * 0x1.0p-53;
+}
+
+Philox4x32::Counter counterFor(std::uint64_t path, std::uint64_t k) {
+    return {static_cast<std::uint32_t>(k), static_cast<std::uint32_t>(k >> 32),
+            static_cast<std::uint32_t>(path), static_cast<std::uint32_t>(path >> 32)};
+}
+
+void increment(Philox4x32::Counter& ctr, std::uint64_t n) {
+    std::uint64_t lo = (static_cast<std::uint64_t>(ctr[1]) << 32) | ctr[0];
+    std::uint64_t next = lo + n;
+    ctr[0] = static_cast<std::uint32_t>(next);
+    ctr[1] = static_cast<std::uint32_t>(next >> 32);
+    if (next < lo) {
+        // retenue sur la moitié haute
+        std::uint64_t hi = ((static_cast<std::uint64_t>(ctr[3]) << 32) | ctr[2]) + 1;
+        ctr[2] = static_cast<std::uint32_t>(hi);
+        ctr[3] = static_cast<std::uint32_t>(hi >> 32);
+    }
+}
+
+} 
+
+Philox4x32::Counter Philox4x32::operator()(Counter ctr) const {
+    Key key = key_;
+    for (int round = 0; round < 10; ++round) {
+        std::uint32_t hi0, lo0, hi1, lo1;
+        mulHiLo(philoxM0, ctr[0], hi0, lo0);
+        mulHiLo(philoxM1, ctr[2], hi1, lo1);
+        ctr = {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+        key[0] += philoxW0;
+        key[1] += philoxW1;
+    }
+    return ctr;
+}
+
+double Philox4x32::uniform(std::uint64_t path, std::uint64_t step) const {
+    Counter out = (*this)(counterFor(path, step / 2));
+    return (step % 2 == 0) ? toUniform(out[0], out[1]) : toUniform(out[2], out[3]);
+}
+
+void Philox4x32::uniforms(std::uint64_t path, std::uint64_t firstStep,
+                          double* u, std::size_t n) const
+{
+    std::size_t k = 0;
+    if (n > 0 && firstStep % 2 != 0) {
+        u[k++] = uniform(path, firstStep);
+    }
+    for (; k + 1 < n; k += 2) {
+        Counter out = (*this)(counterFor(path, (firstStep + k) / 2));
+        u[k]     = toUniform(out[0], out[1]);
+        u[k + 1] = toUniform(out[2], out[3]);
+    }
+    if (k < n) {
+        u[k] = uniform(path, firstStep + k);
+    }
+}
+
+PhiloxEngine::result_type PhiloxEngine::operator()() {
+    if (used_ == 4) {
+        output_ = philox_(counter_);
+        increment(counter_, 1);
+        used_ = 0;
+    }
+    return output_[used_++];
+}
+
+void PhiloxEngine::discard(std::uint64_t n) {
+    std::uint64_t available = 4 - used_;
+    if (n <= available) {
+        used_ += static_cast<std::size_t>(n);
+        return;
+    }
+    n -= available;
+    // n mots restants : blocs entiers sautés, puis reste dans le bloc suivant
+    increment(counter_, n / 4);
+    used_ = 4;
+    std::size_t rest = static_cast<std::size_t>(n % 4);
+    if (rest > 0) {
+        output_ = philox_(counter_);
+        increment(counter_, 1);
+        used_ = rest;
+    }
+}
+
+} 
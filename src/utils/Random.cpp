@@ -0,0 +1,18 @@
+#include "utils/Random.hpp"
+
+#include <cstdint>
+
+namespace pricer::utils {
+
+std::mt19937_64 makeSubstream(unsigned long seed, std::size_t stream) {
+    auto s = static_cast<std::uint64_t>(seed);
+    auto k = static_cast<std::uint64_t>(stream);
+
+    std::seed_seq seq{
+        static_cast<std::uint32_t>(s), static_cast<std::uint32_t>(s >> 32),
+        static_cast<std::uint32_t>(k), static_cast<std::uint32_t>(k >> 32)
+    };
+    return std::mt19937_64(seq);
+}
+
+} 
@@ -0,0 +1,211 @@
+#include "utils/Sobol.hpp"
+
+#include <mutex>
+#include <random>
+#include <stdexcept>
+
+namespace pricer::utils {
+
+namespace {
+
+constexpr int kBits = 32;
+
+// Produit de deux polynômes sur GF(2) modulo p (degré deg)
+std::uint64_t mulMod(std::uint64_t a, std::uint64_t b, std::uint64_t p, int deg) {
+    std::uint64_t res = 0;
+    while (b) {
+        if (b & 1U) res ^= a;
+        b >>= 1;
+        a <<= 1;
+        if (a >> deg & 1U) a ^= p;
+    }
+    return res;
+}
+
+std::uint64_t powMod(std::uint64_t e, std::uint64_t p, int deg) {
+    std::uint64_t res = 1, base = 2; // polynôme "x"
+    while (e) {
+        if (e & 1U) res = mulMod(res, base, p, deg);
+        base = mulMod(base, base, p, deg);
+        e >>= 1;
+    }
+    return res;
+}
+
+// p est primitif ssi x est d'ordre exactement 2^deg - 1 modulo p
+bool isPrimitive(std::uint64_t p, int deg, const std::vector<std::uint64_t>& primeFactors) {
+    std::uint64_t order = (std::uint64_t{1} << deg) - 1;
+    if (powMod(order, p, deg) != 1) return false;
+    for (auto f : primeFactors) {
+        if (powMod(order / f, p, deg) == 1) return false;
+    }
+    return true;
+}
+
+std::vector<std::uint64_t> primeFactors(std::uint64_t n) {
+    std::vector<std::uint64_t> res;
+    for (std::uint64_t f = 2; f * f <= n; ++f) {
+        if (n % f == 0) {
+            res.push_back(f);
+            while (n % f == 0) n /= f;
+        }
+    }
+    if (n > 1) res.push_back(n);
+    return res;
+}
+
+// Polynômes primitifs par degré croissant (bit de poids fort = degré).
+// La table est complétée à la demande, degré par degré.
+std::vector<std::uint64_t> primitivePolynomials(std::size_t count) {
+    static std::mutex mutex;
+    static std::vector<std::uint64_t> table;
+    static int lastDegree = 0;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    while (table.size() < count) {
+        int deg = ++lastDegree;
+        auto factors = primeFactors((std::uint64_t{1} << deg) - 1);
+        for (std::uint64_t mid = 0; mid < (std::uint64_t{1} << (deg - 1)); ++mid) {
+            std::uint64_t p = (std::uint64_t{1} << deg) | (mid << 1) | 1U;
+            if (isPrimitive(p, deg, factors)) {
+                table.push_back(p);
+            }
+        }
+    }
+    return std::vector<std::uint64_t>(table.begin(), table.begin() + count);
+}
+
+int degreeOf(std::uint64_t p) {
+    int deg = 0;
+    while (p >> (deg + 1)) ++deg;
+    return deg;
+}
+
+} 
+
+SobolSequence::SobolSequence(std::size_t dimension)
+    : dimension_(dimension)
+{
+    initDirections(false, 0UL);
+}
+
+SobolSequence::SobolSequence(std::size_t dimension, unsigned long scrambleSeed)
+    : dimension_(dimension)
+{
+    initDirections(true, scrambleSeed);
+}
+
+void SobolSequence::initDirections(bool scrambled, unsigned long scrambleSeed) {
+    if (dimension_ == 0 || dimension_ > maxDimension) {
+        throw std::runtime_error("SobolSequence: dimension hors limites");
+    }
+
+    directions_.assign(static_cast<std::size_t>(kBits) * dimension_, 0U);
+    auto dir = [&](int k, std::size_t d) -> std::uint32_t& {
+        return directions_[static_cast<std::size_t>(k) * dimension_ + d];
+    };
+
+    // Dimension 1 : suite de van der Corput
+    for (int k = 0; k < kBits; ++k) {
+        dir(k, 0) = std::uint32_t{1} << (kBits - 1 - k);
+    }
+
+    auto polys = primitivePolynomials(dimension_ - 1);
+    std::mt19937 initGen(20021994U); // graine fixe : suite reproductible
+
+    for (std::size_t d = 1; d < dimension_; ++d) {
+        std::uint64_t p = polys[d - 1];
+        int s = degreeOf(p);
+
+        std::vector<std::uint32_t> m(kBits);
+        for (int k = 0; k < s && k < kBits; ++k) {
+            // m_k impair et < 2^(k+1)
+            std::uint32_t range = std::uint32_t{1} << k;
+            m[k] = 2U * (initGen() % range) + 1U;
+        }
+        for (int k = s; k < kBits; ++k) {
+            std::uint32_t v = m[k - s] ^ (m[k - s] << s);
+            for (int j = 1; j < s; ++j) {
+                if (p >> (s - j) & 1U) {
+                    v ^= m[k - j] << j;
+                }
+            }
+            m[k] = v;
+        }
+        for (int k = 0; k < kBits; ++k) {
+            dir(k, d) = m[k] << (kBits - 1 - k);
+        }
+    }
+
+    shift_.assign(dimension_, 0U);
+
+    if (scrambled) {
+        std::mt19937_64 gen(scrambleSeed);
+
+        for (std::size_t d = 0; d < dimension_; ++d) {
+            // Matrice triangulaire inférieure aléatoire à diagonale unité,
+            // ligne i = masque des chiffres (du poids fort) combinés
+            std::uint32_t rows[kBits];
+            for (int i = 0; i < kBits; ++i) {
+                std::uint32_t diag  = std::uint32_t{1} << (kBits - 1 - i);
+                std::uint32_t above = (i == 0) ? 0U : ~((diag << 1) - 1U);
+                rows[i] = diag | (static_cast<std::uint32_t>(gen()) & above);
+            }
+            for (int k = 0; k < kBits; ++k) {
+                std::uint32_t v = dir(k, d);
+                std::uint32_t w = 0;
+                for (int i = 0; i < kBits; ++i) {
+                    std::uint32_t parity = v & rows[i];
+                    parity ^= parity >> 16;
+                    parity ^= parity >> 8;
+                    parity ^= parity >> 4;
+                    parity ^= parity >> 2;
+                    parity ^= parity >> 1;
+                    w |= (parity & 1U) << (kBits - 1 - i);
+                }
+                dir(k, d) = w;
+            }
+            shift_[d] = static_cast<std::uint32_t>(gen());
+        }
+    }
+
+    skipTo(0);
+}
+
+void SobolSequence::skipTo(std::uint64_t index) {
+    if (index >> kBits) {
+        throw std::runtime_error("SobolSequence: index au-delà de 2^32");
+    }
+
+    index_ = index;
+    state_ = shift_;
+
+    std::uint64_t gray = index ^ (index >> 1);
+    for (int k = 0; gray; ++k, gray >>= 1) {
+        if (gray & 1U) {
+            for (std::size_t d = 0; d < dimension_; ++d) {
+                state_[d] ^= directions_[static_cast<std::size_t>(k) * dimension_ + d];
+            }
+        }
+    }
+}
+
+void SobolSequence::next(double* u) {
+    constexpr double norm = 1.0 / 4294967296.0; // 2^-32
+    for (std::size_t d = 0; d < dimension_; ++d) {
+        u[d] = (static_cast<double>(state_[d]) + 0.5) * norm;
+    }
+
+    // Code de Gray : on change le bit de poids faible nul de index_
+    int k = 0;
+    while (index_ >> k & 1U) ++k;
+    if (k >= kBits) {
+        throw std::runtime_error("SobolSequence: suite épuisée");
+    }
+    for (std::size_t d = 0; d < dimension_; ++d) {
+        state_[d] ^= directions_[static_cast<std::size_t>(k) * dimension_ + d];
+    }
+    ++index_;
+}
+
+} 
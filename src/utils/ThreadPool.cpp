@@ -0,0 +1,114 @@
+#include "utils/ThreadPool.hpp"
+#include "utils/Parallel.hpp"
+
+namespace pricer::utils {
+
+namespace {
+
+// Thread courant : pool d'appartenance et indice de sa file
+thread_local ThreadPool* tlsPool = nullptr;
+thread_local std::size_t tlsIndex = 0;
+
+} 
+
+ThreadPool::ThreadPool(std::size_t nThreads) {
+    std::size_t n = resolveThreadCount(nThreads);
+    local_.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        local_.push_back(std::make_unique<Queue>());
+    }
+    workers_.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        workers_.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    ready_.notify_all();
+    for (auto& w : workers_) {
+        w.join();
+    }
+}
+
+ThreadPool* ThreadPool::current() {
+    return tlsPool;
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    // Compté avant d'être visible : pending_ ne passe jamais sous zéro
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++pending_;
+    }
+    Queue& q = (tlsPool == this) ? *local_[tlsIndex] : injected_;
+    {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        q.tasks.push_back(std::move(task));
+    }
+    ready_.notify_one();
+}
+
+bool ThreadPool::pop(std::size_t self, std::function<void()>& task) {
+    auto take = [&](Queue& q, bool back) {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty()) return false;
+        if (back) {
+            task = std::move(q.tasks.back());
+            q.tasks.pop_back();
+        } else {
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+        }
+        return true;
+    };
+
+    // Sa file d'abord, puis les soumissions externes, puis le vol
+    bool found = take(*local_[self], true) || take(injected_, false);
+    for (std::size_t k = 1; !found && k < local_.size(); ++k) {
+        found = take(*local_[(self + k) % local_.size()], false);
+    }
+    if (found) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --pending_;
+    }
+    return found;
+}
+
+bool ThreadPool::runPendingTask() {
+    std::function<void()> task;
+    if (!pop(tlsIndex, task)) {
+        return false;
+    }
+    task();
+    return true;
+}
+
+void ThreadPool::workerLoop(std::size_t self) {
+    tlsPool  = this;
+    tlsIndex = self;
+
+    std::function<void()> task;
+    for (;;) {
+        if (pop(self, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_.wait(lock, [this] { return stopping_ || pending_ > 0; });
+        if (stopping_ && pending_ == 0) {
+            return; // arrêt demandé, files vidées
+        }
+    }
+}
+
+ThreadPool& defaultThreadPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+} 
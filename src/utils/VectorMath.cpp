@@ -0,0 +1,561 @@
+#include "utils/VectorMath.hpp"
+
+#include "utils/BlackFormula.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define PRICER_X86_SIMD 1
+// Faux positifs de GCC 12 dans avx512fintrin.h (_mm512_undefined_pd)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+#include <immintrin.h>
+#endif
+
+namespace pricer::utils {
+
+namespace {
+
+// ---- Constantes communes ----
+
+constexpr double kLog2e  = 1.4426950408889634074;
+constexpr double kLn2Hi  = 6.93145751953125e-1;
+constexpr double kLn2Lo  = 1.42860682030941723212e-6;
+constexpr double kExpMin = -708.0;
+constexpr double kExpMax = 709.0;
+constexpr double kSqrt2  = 1.41421356237309504880;
+
+// exp(r) sur |r| <= ln2/2 : Taylor d'ordre 13 (erreur < 1e-17)
+constexpr double kExpCoeffs[] = {
+    1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0,
+    1.0 / 362880.0,     1.0 / 40320.0,     1.0 / 5040.0,     1.0 / 720.0,
+    1.0 / 120.0,        1.0 / 24.0,        1.0 / 6.0,        0.5,
+    1.0,                1.0
+};
+
+// log(m) = f * P(f^2), f = (m-1)/(m+1), m dans [sqrt(2)/2, sqrt(2)]
+constexpr double kLogCoeffs[] = {
+    2.0 / 21.0, 2.0 / 19.0, 2.0 / 17.0, 2.0 / 15.0, 2.0 / 13.0, 2.0 / 11.0,
+    2.0 / 9.0,  2.0 / 7.0,  2.0 / 5.0,  2.0 / 3.0,  2.0
+};
+
+// Acklam
+constexpr double kA[] = {
+    -3.969683028665376e+01,  2.209460984245205e+02, -2.759285104469687e+02,
+     1.383577518672690e+02, -3.066479806614716e+01,  2.506628277459239e+00
+};
+constexpr double kB[] = {
+    -5.447609879822406e+01,  1.615858368580409e+02, -1.556989798598866e+02,
+     6.680131188771972e+01, -1.328068155288572e+01,  1.0
+};
+constexpr double kC[] = {
+    -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+    -2.549732539343734e+00,  4.374664141464968e+00,  2.938163982698783e+00
+};
+constexpr double kD[] = {
+     7.784695709041462e-03,  3.224671290700398e-01,  2.445134137142996e+00,
+     3.754408661907416e+00,  1.0
+};
+constexpr double kPLow = 0.02425;
+
+// erfc(z) = t exp(-z^2 + f(u)) pour z >= 0, t = 2 / (2 + z) ; f développé
+// en série de Tchebychev de u = (2t - 1 - tMin) / (1 - tMin), tMin = 2/29
+// (z <= 27). Coefficients calculés en précision étendue, troncature < 3e-18.
+constexpr double kErfcCheb[] = {
+    -6.10740152366562316644e-01,  6.05358446343444600579e-01,  1.38976047331368819659e-02,
+    -8.26497008157385873450e-03, -5.41970783184366551762e-04,  2.88573298956413691520e-04,
+     1.56448679794249317736e-05, -1.38032729774937212765e-05, -4.20155333655095568794e-09,
+     7.16097914737282322577e-07, -5.77388713280987815243e-08, -3.43600121501764353411e-08,
+     6.75837346089122569842e-09,  1.21572039048224081293e-09, -5.34783073331980509212e-10,
+    -2.12162829708437730993e-12,  3.11554755859400019072e-11, -4.30653284067996646651e-12,
+    -1.13011540208267761334e-12,  4.17865206178288555291e-13, -5.70428089553642808613e-15,
+    -2.15536521461360716199e-14,  4.12873725127280322212e-15,  3.21490865344253688450e-16,
+    -2.65163377832380760896e-16,  4.16977208224693956544e-17,  2.24038750695755517272e-18,
+    -2.60923018580950396181e-18
+};
+constexpr std::size_t kErfcChebSize = sizeof(kErfcCheb) / sizeof(double);
+constexpr double kErfcU1 = 2.1481481481481484;   // 2 / (1 - tMin)
+constexpr double kErfcU0 = 1.1481481481481481;   // (1 + tMin) / (1 - tMin)
+// Au-delà, exp(-z^2) sort du domaine de exp4/exp8 ; erfc(z) < 1e-306
+constexpr double kErfcZMax = 26.5;
+
+// ---- Scalaire ----
+
+double acklam(double u) {
+    if (u < kPLow || u > 1.0 - kPLow) {
+        double t = std::min(u, 1.0 - u);
+        double q = std::sqrt(-2.0 * std::log(t));
+        double x = (((((kC[0] * q + kC[1]) * q + kC[2]) * q + kC[3]) * q + kC[4]) * q + kC[5]) /
+                   ((((kD[0] * q + kD[1]) * q + kD[2]) * q + kD[3]) * q + kD[4]);
+        return (u < 0.5) ? x : -x;
+    }
+    double q = u - 0.5;
+    double r = q * q;
+    return (((((kA[0] * r + kA[1]) * r + kA[2]) * r + kA[3]) * r + kA[4]) * r + kA[5]) * q /
+           (((((kB[0] * r + kB[1]) * r + kB[2]) * r + kB[3]) * r + kB[4]) * r + kB[5]);
+}
+
+void expScalar(const double* x, double* y, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) y[i] = std::exp(x[i]);
+}
+
+void logScalar(const double* x, double* y, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) y[i] = std::log(x[i]);
+}
+
+void invNormScalar(const double* u, double* y, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) y[i] = acklam(u[i]);
+}
+
+// erfcx(z) = t exp(f(u)), z >= 0
+double erfcxPositive(double z) {
+    double t = 2.0 / (2.0 + z);
+    double u = t * kErfcU1 - kErfcU0;
+    double b1 = 0.0, b2 = 0.0;
+    for (std::size_t k = kErfcChebSize - 1; k >= 1; --k) {
+        double b0 = 2.0 * u * b1 - b2 + kErfcCheb[k];
+        b2 = b1;
+        b1 = b0;
+    }
+    return t * std::exp(u * b1 - b2 + kErfcCheb[0]);
+}
+
+void normCdfScalar(const double* x, double* y, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) y[i] = normalCdf(x[i]);
+}
+
+#ifdef PRICER_X86_SIMD
+
+// ---- AVX2 + FMA ----
+
+#define PRICER_AVX2 __attribute__((target("avx2,fma")))
+
+// exp(x + dx), dx petit devant x : dx est ajouté après la réduction
+// d'argument, sans arrondir x + dx
+PRICER_AVX2 inline __m256d exp4(__m256d x, __m256d dx) {
+    x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(kExpMin)), _mm256_set1_pd(kExpMax));
+    __m256d k = _mm256_round_pd(_mm256_mul_pd(_mm256_add_pd(x, dx), _mm256_set1_pd(kLog2e)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(k, _mm256_set1_pd(kLn2Hi), x);
+    r = _mm256_fnmadd_pd(k, _mm256_set1_pd(kLn2Lo), r);
+    r = _mm256_add_pd(r, dx);
+
+    __m256d p = _mm256_set1_pd(kExpCoeffs[0]);
+    for (std::size_t c = 1; c < sizeof(kExpCoeffs) / sizeof(double); ++c) {
+        p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(kExpCoeffs[c]));
+    }
+
+    // 2^k construit directement dans le champ exposant
+    __m256i ki = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k));
+    ki = _mm256_slli_epi64(_mm256_add_epi64(ki, _mm256_set1_epi64x(1023)), 52);
+    return _mm256_mul_pd(p, _mm256_castsi256_pd(ki));
+}
+
+PRICER_AVX2 inline __m256d exp4(__m256d x) {
+    return exp4(x, _mm256_setzero_pd());
+}
+
+PRICER_AVX2 inline __m256d log4(__m256d x) {
+    const __m256i mantMask = _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL);
+    const __m256i oneBits  = _mm256_set1_epi64x(0x3FF0000000000000LL);
+    const __m256i magic    = _mm256_set1_epi64x(0x4330000000000000LL); // 2^52
+
+    __m256i bits = _mm256_castpd_si256(x);
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, mantMask), oneBits));
+    __m256d e = _mm256_sub_pd(
+        _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), magic)),
+        _mm256_set1_pd(4503599627370496.0 + 1023.0));
+
+    __m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(kSqrt2), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    e = _mm256_add_pd(e, _mm256_and_pd(big, _mm256_set1_pd(1.0)));
+
+    const __m256d one = _mm256_set1_pd(1.0);
+    __m256d f  = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+    __m256d f2 = _mm256_mul_pd(f, f);
+
+    __m256d p = _mm256_set1_pd(kLogCoeffs[0]);
+    for (std::size_t c = 1; c < sizeof(kLogCoeffs) / sizeof(double); ++c) {
+        p = _mm256_fmadd_pd(p, f2, _mm256_set1_pd(kLogCoeffs[c]));
+    }
+
+    __m256d lo = _mm256_fmadd_pd(e, _mm256_set1_pd(kLn2Lo), _mm256_mul_pd(f, p));
+    return _mm256_fmadd_pd(e, _mm256_set1_pd(kLn2Hi), lo);
+}
+
+template <std::size_t N>
+PRICER_AVX2 inline __m256d horner4(const double (&c)[N], __m256d x) {
+    __m256d p = _mm256_set1_pd(c[0]);
+    for (std::size_t i = 1; i < N; ++i) {
+        p = _mm256_fmadd_pd(p, x, _mm256_set1_pd(c[i]));
+    }
+    return p;
+}
+
+PRICER_AVX2 inline __m256d invNorm4(__m256d u) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d one  = _mm256_set1_pd(1.0);
+
+    __m256d q = _mm256_sub_pd(u, half);
+    __m256d r = _mm256_mul_pd(q, q);
+    __m256d x = _mm256_div_pd(_mm256_mul_pd(horner4(kA, r), q), horner4(kB, r));
+
+    __m256d t    = _mm256_min_pd(u, _mm256_sub_pd(one, u));
+    __m256d tail = _mm256_cmp_pd(t, _mm256_set1_pd(kPLow), _CMP_LT_OQ);
+
+    if (_mm256_movemask_pd(tail)) {
+        __m256d s  = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_set1_pd(-2.0), log4(t)));
+        __m256d xt = _mm256_div_pd(horner4(kC, s), horner4(kD, s));
+        __m256d upper = _mm256_cmp_pd(u, half, _CMP_GT_OQ);
+        xt = _mm256_blendv_pd(xt, _mm256_sub_pd(_mm256_setzero_pd(), xt), upper);
+        x  = _mm256_blendv_pd(x, xt, tail);
+    }
+    return x;
+}
+
+// N(x) = erfc(-x / sqrt(2)) / 2, erfc pris sur |z| puis réfléchi.
+// U vecteurs sont traités ensemble : la récurrence de Clenshaw est
+// limitée par la latence, l'entrelacement la masque.
+template <int U>
+PRICER_AVX2 inline void normCdf4(const double* x, double* y) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d two  = _mm256_set1_pd(2.0);
+
+    __m256d z[U], a[U], t[U], u2[U], b1[U], b2[U];
+#pragma GCC unroll 4
+    for (int j = 0; j < U; ++j) {
+        z[j]  = _mm256_div_pd(_mm256_sub_pd(zero, _mm256_loadu_pd(x + 4 * j)), _mm256_set1_pd(kSqrt2));
+        a[j]  = _mm256_andnot_pd(_mm256_set1_pd(-0.0), z[j]);
+        t[j]  = _mm256_div_pd(two, _mm256_add_pd(two, a[j]));
+        __m256d u = _mm256_fmsub_pd(t[j], _mm256_set1_pd(kErfcU1), _mm256_set1_pd(kErfcU0));
+        u2[j] = _mm256_add_pd(u, u);
+        b1[j] = zero;
+        b2[j] = zero;
+    }
+    for (std::size_t k = kErfcChebSize - 1; k >= 1; --k) {
+        const __m256d c = _mm256_set1_pd(kErfcCheb[k]);
+#pragma GCC unroll 4
+        for (int j = 0; j < U; ++j) {
+            __m256d b0 = _mm256_add_pd(_mm256_fmsub_pd(u2[j], b1[j], b2[j]), c);
+            b2[j] = b1[j];
+            b1[j] = b0;
+        }
+    }
+#pragma GCC unroll 4
+    for (int j = 0; j < U; ++j) {
+        __m256d u = _mm256_mul_pd(u2[j], _mm256_set1_pd(0.5));
+        __m256d f = _mm256_add_pd(_mm256_fmsub_pd(u, b1[j], b2[j]), _mm256_set1_pd(kErfcCheb[0]));
+
+        // exp(-z^2 + f) avec z^2 = hi + lo exact
+        __m256d hi = _mm256_mul_pd(a[j], a[j]);
+        __m256d lo = _mm256_fmsub_pd(a[j], a[j], hi);
+        __m256d e  = _mm256_mul_pd(t[j], exp4(_mm256_sub_pd(zero, hi), _mm256_sub_pd(f, lo)));
+        e = _mm256_andnot_pd(_mm256_cmp_pd(a[j], _mm256_set1_pd(kErfcZMax), _CMP_GT_OQ), e);
+
+        __m256d neg   = _mm256_cmp_pd(z[j], zero, _CMP_LT_OQ);
+        __m256d lower = _mm256_mul_pd(_mm256_set1_pd(0.5), e);
+        _mm256_storeu_pd(y + 4 * j,
+                         _mm256_blendv_pd(lower, _mm256_sub_pd(_mm256_set1_pd(1.0), lower), neg));
+    }
+}
+
+PRICER_AVX2 void expAvx2(const double* x, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, exp4(_mm256_loadu_pd(x + i)));
+    }
+    expScalar(x + i, y + i, n - i);
+}
+
+PRICER_AVX2 void logAvx2(const double* x, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, log4(_mm256_loadu_pd(x + i)));
+    }
+    logScalar(x + i, y + i, n - i);
+}
+
+PRICER_AVX2 void invNormAvx2(const double* u, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(y + i, invNorm4(_mm256_loadu_pd(u + i)));
+    }
+    invNormScalar(u + i, y + i, n - i);
+}
+
+PRICER_AVX2 void normCdfAvx2(const double* x, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        normCdf4<4>(x + i, y + i);
+    }
+    for (; i + 4 <= n; i += 4) {
+        normCdf4<1>(x + i, y + i);
+    }
+    normCdfScalar(x + i, y + i, n - i);
+}
+
+// ---- AVX-512 ----
+
+#define PRICER_AVX512 __attribute__((target("avx512f")))
+
+PRICER_AVX512 inline __m512d exp8(__m512d x, __m512d dx) {
+    x = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(kExpMin)), _mm512_set1_pd(kExpMax));
+    __m512d k = _mm512_roundscale_pd(_mm512_mul_pd(_mm512_add_pd(x, dx), _mm512_set1_pd(kLog2e)),
+                                     _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512d r = _mm512_fnmadd_pd(k, _mm512_set1_pd(kLn2Hi), x);
+    r = _mm512_fnmadd_pd(k, _mm512_set1_pd(kLn2Lo), r);
+    r = _mm512_add_pd(r, dx);
+
+    __m512d p = _mm512_set1_pd(kExpCoeffs[0]);
+    for (std::size_t c = 1; c < sizeof(kExpCoeffs) / sizeof(double); ++c) {
+        p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(kExpCoeffs[c]));
+    }
+    return _mm512_scalef_pd(p, k);
+}
+
+PRICER_AVX512 inline __m512d exp8(__m512d x) {
+    return exp8(x, _mm512_setzero_pd());
+}
+
+PRICER_AVX512 inline __m512d log8(__m512d x) {
+    const __m512i mantMask = _mm512_set1_epi64(0x000FFFFFFFFFFFFFLL);
+    const __m512i oneBits  = _mm512_set1_epi64(0x3FF0000000000000LL);
+    const __m512i magic    = _mm512_set1_epi64(0x4330000000000000LL);
+
+    __m512i bits = _mm512_castpd_si512(x);
+    __m512d m = _mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(bits, mantMask), oneBits));
+    __m512d e = _mm512_sub_pd(
+        _mm512_castsi512_pd(_mm512_or_si512(_mm512_srli_epi64(bits, 52), magic)),
+        _mm512_set1_pd(4503599627370496.0 + 1023.0));
+
+    __mmask8 big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(kSqrt2), _CMP_GT_OQ);
+    m = _mm512_mask_mul_pd(m, big, m, _mm512_set1_pd(0.5));
+    e = _mm512_mask_add_pd(e, big, e, _mm512_set1_pd(1.0));
+
+    const __m512d one = _mm512_set1_pd(1.0);
+    __m512d f  = _mm512_div_pd(_mm512_sub_pd(m, one), _mm512_add_pd(m, one));
+    __m512d f2 = _mm512_mul_pd(f, f);
+
+    __m512d p = _mm512_set1_pd(kLogCoeffs[0]);
+    for (std::size_t c = 1; c < sizeof(kLogCoeffs) / sizeof(double); ++c) {
+        p = _mm512_fmadd_pd(p, f2, _mm512_set1_pd(kLogCoeffs[c]));
+    }
+
+    __m512d lo = _mm512_fmadd_pd(e, _mm512_set1_pd(kLn2Lo), _mm512_mul_pd(f, p));
+    return _mm512_fmadd_pd(e, _mm512_set1_pd(kLn2Hi), lo);
+}
+
+template <std::size_t N>
+PRICER_AVX512 inline __m512d horner8(const double (&c)[N], __m512d x) {
+    __m512d p = _mm512_set1_pd(c[0]);
+    for (std::size_t i = 1; i < N; ++i) {
+        p = _mm512_fmadd_pd(p, x, _mm512_set1_pd(c[i]));
+    }
+    return p;
+}
+
+PRICER_AVX512 inline __m512d invNorm8(__m512d u) {
+    const __m512d half = _mm512_set1_pd(0.5);
+    const __m512d one  = _mm512_set1_pd(1.0);
+
+    __m512d q = _mm512_sub_pd(u, half);
+    __m512d r = _mm512_mul_pd(q, q);
+    __m512d x = _mm512_div_pd(_mm512_mul_pd(horner8(kA, r), q), horner8(kB, r));
+
+    __m512d t     = _mm512_min_pd(u, _mm512_sub_pd(one, u));
+    __mmask8 tail = _mm512_cmp_pd_mask(t, _mm512_set1_pd(kPLow), _CMP_LT_OQ);
+
+    if (tail) {
+        __m512d s  = _mm512_sqrt_pd(_mm512_mul_pd(_mm512_set1_pd(-2.0), log8(t)));
+        __m512d xt = _mm512_div_pd(horner8(kC, s), horner8(kD, s));
+        __mmask8 upper = _mm512_cmp_pd_mask(u, half, _CMP_GT_OQ);
+        xt = _mm512_mask_sub_pd(xt, upper, _mm512_setzero_pd(), xt);
+        x  = _mm512_mask_blend_pd(tail, x, xt);
+    }
+    return x;
+}
+
+template <int U>
+PRICER_AVX512 inline void normCdf8(const double* x, double* y) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d two  = _mm512_set1_pd(2.0);
+
+    __m512d z[U], a[U], t[U], u2[U], b1[U], b2[U];
+#pragma GCC unroll 4
+    for (int j = 0; j < U; ++j) {
+        z[j]  = _mm512_div_pd(_mm512_sub_pd(zero, _mm512_loadu_pd(x + 8 * j)), _mm512_set1_pd(kSqrt2));
+        a[j]  = _mm512_abs_pd(z[j]);
+        t[j]  = _mm512_div_pd(two, _mm512_add_pd(two, a[j]));
+        __m512d u = _mm512_fmsub_pd(t[j], _mm512_set1_pd(kErfcU1), _mm512_set1_pd(kErfcU0));
+        u2[j] = _mm512_add_pd(u, u);
+        b1[j] = zero;
+        b2[j] = zero;
+    }
+    for (std::size_t k = kErfcChebSize - 1; k >= 1; --k) {
+        const __m512d c = _mm512_set1_pd(kErfcCheb[k]);
+#pragma GCC unroll 4
+        for (int j = 0; j < U; ++j) {
+            __m512d b0 = _mm512_add_pd(_mm512_fmsub_pd(u2[j], b1[j], b2[j]), c);
+            b2[j] = b1[j];
+            b1[j] = b0;
+        }
+    }
+#pragma GCC unroll 4
+    for (int j = 0; j < U; ++j) {
+        __m512d u = _mm512_mul_pd(u2[j], _mm512_set1_pd(0.5));
+        __m512d f = _mm512_add_pd(_mm512_fmsub_pd(u, b1[j], b2[j]), _mm512_set1_pd(kErfcCheb[0]));
+
+        __m512d hi = _mm512_mul_pd(a[j], a[j]);
+        __m512d lo = _mm512_fmsub_pd(a[j], a[j], hi);
+        __m512d e  = _mm512_mul_pd(t[j], exp8(_mm512_sub_pd(zero, hi), _mm512_sub_pd(f, lo)));
+        __mmask8 far = _mm512_cmp_pd_mask(a[j], _mm512_set1_pd(kErfcZMax), _CMP_GT_OQ);
+        e = _mm512_mask_mov_pd(e, far, zero);
+
+        __mmask8 neg  = _mm512_cmp_pd_mask(z[j], zero, _CMP_LT_OQ);
+        __m512d lower = _mm512_mul_pd(_mm512_set1_pd(0.5), e);
+        _mm512_storeu_pd(y + 8 * j, _mm512_mask_sub_pd(lower, neg, _mm512_set1_pd(1.0), lower));
+    }
+}
+
+PRICER_AVX512 void expAvx512(const double* x, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, exp8(_mm512_loadu_pd(x + i)));
+    }
+    expScalar(x + i, y + i, n - i);
+}
+
+PRICER_AVX512 void logAvx512(const double* x, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, log8(_mm512_loadu_pd(x + i)));
+    }
+    logScalar(x + i, y + i, n - i);
+}
+
+PRICER_AVX512 void invNormAvx512(const double* u, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(y + i, invNorm8(_mm512_loadu_pd(u + i)));
+    }
+    invNormScalar(u + i, y + i, n - i);
+}
+
+PRICER_AVX512 void normCdfAvx512(const double* x, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        normCdf8<4>(x + i, y + i);
+    }
+    for (; i + 8 <= n; i += 8) {
+        normCdf8<1>(x + i, y + i);
+    }
+    normCdfScalar(x + i, y + i, n - i);
+}
+
+#endif // PRICER_X86_SIMD
+
+// Niveau demandé borné par ce que supporte le processeur
+SimdLevel effectiveLevel(SimdLevel level) {
+    SimdLevel best = detectSimdLevel();
+    return (static_cast<int>(level) < static_cast<int>(best)) ? level : best;
+}
+
+} 
+
+SimdLevel detectSimdLevel() {
+    static const SimdLevel level = []() {
+#ifdef PRICER_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SimdLevel::AVX2;
+        }
+#endif
+        return SimdLevel::Scalar;
+    }();
+    return level;
+}
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512: return "AVX-512";
+        case SimdLevel::AVX2:   return "AVX2";
+        case SimdLevel::Scalar: break;
+    }
+    return "scalaire";
+}
+
+void vexp(const double* x, double* y, std::size_t n) {
+    vexp(x, y, n, detectSimdLevel());
+}
+
+void vexp(const double* x, double* y, std::size_t n, SimdLevel level) {
+    switch (effectiveLevel(level)) {
+#ifdef PRICER_X86_SIMD
+        case SimdLevel::AVX512: expAvx512(x, y, n); return;
+        case SimdLevel::AVX2:   expAvx2(x, y, n);   return;
+#endif
+        default: expScalar(x, y, n); return;
+    }
+}
+
+void vlog(const double* x, double* y, std::size_t n) {
+    vlog(x, y, n, detectSimdLevel());
+}
+
+void vlog(const double* x, double* y, std::size_t n, SimdLevel level) {
+    switch (effectiveLevel(level)) {
+#ifdef PRICER_X86_SIMD
+        case SimdLevel::AVX512: logAvx512(x, y, n); return;
+        case SimdLevel::AVX2:   logAvx2(x, y, n);   return;
+#endif
+        default: logScalar(x, y, n); return;
+    }
+}
+
+void vinverseNormalCdf(const double* u, double* y, std::size_t n) {
+    vinverseNormalCdf(u, y, n, detectSimdLevel());
+}
+
+void vinverseNormalCdf(const double* u, double* y, std::size_t n, SimdLevel level) {
+    switch (effectiveLevel(level)) {
+#ifdef PRICER_X86_SIMD
+        case SimdLevel::AVX512: invNormAvx512(u, y, n); return;
+        case SimdLevel::AVX2:   invNormAvx2(u, y, n);   return;
+#endif
+        default: invNormScalar(u, y, n); return;
+    }
+}
+
+void vnormalCdf(const double* x, double* y, std::size_t n) {
+    vnormalCdf(x, y, n, detectSimdLevel());
+}
+
+void vnormalCdf(const double* x, double* y, std::size_t n, SimdLevel level) {
+    switch (effectiveLevel(level)) {
+#ifdef PRICER_X86_SIMD
+        case SimdLevel::AVX512: normCdfAvx512(x, y, n); return;
+        case SimdLevel::AVX2:   normCdfAvx2(x, y, n);   return;
+#endif
+        default: normCdfScalar(x, y, n); return;
+    }
+}
+
+double erfcx(double x) {
+    if (x >= 0.0) {
+        // au-delà de la plage ajustée : développement asymptotique
+        if (x > 27.0) {
+            double r = 1.0 / (x * x);
+            return (1.0 - 0.5 * r * (1.0 - 1.5 * r)) / (x * 1.77245385090551602730);
+        }
+        return erfcxPositive(x);
+    }
+    return 2.0 * std::exp(x * x) - erfcxPositive(-x);
+}
+
+} 
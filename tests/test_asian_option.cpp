@@ -0,0 +1,158 @@
+#include "doctest/doctest.h"
+
+#include "market/MarketData.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "core/Payoff.hpp"
+#include "core/EngineFactory.hpp"
+#include "products/AsianOption.hpp"
+#include "engines/AsianOptionAnalyticEngine.hpp"
+#include "engines/AsianOptionMCEngine.hpp"
+#include "engines/SharedPathMCEngine.hpp"
+#include "utils/AsianFormula.hpp"
+#include "utils/BlackFormula.hpp"
+
+#include <cmath>
+
+using namespace pricer;
+
+namespace {
+
+// S=100, r=5%, q=1%, vol=30%, T=1
+std::shared_ptr<models::BlackScholesModel> asianModel() {
+    auto discountCurve = std::make_shared<market::YieldCurve>(0.05);
+    auto equityCurve   = std::make_shared<market::EquityCurve>(100.0, 0.01);
+    return std::make_shared<models::BlackScholesModel>(discountCurve, equityCurve, 0.30);
+}
+
+std::vector<double> monthlyFixings() {
+    std::vector<double> t;
+    for (int i = 1; i <= 12; ++i) t.push_back(i / 12.0);
+    return t;
+}
+
+} 
+
+TEST_CASE("AsianOptionAnalyticEngine - approximations contre Monte Carlo") {
+    using OT = core::OptionType;
+    using AA = engines::AsianApproximation;
+
+    // Références : AsianOptionMCEngine, 400000 chemins, variable de
+    // contrôle, 50 pas (erreur type < 1e-3)
+    struct Case { OT type; double K; double mc; };
+    const Case cases[] = {
+        {OT::Call,  80.0, 21.5169}, {OT::Put,  80.0,  0.5263},
+        {OT::Call, 100.0,  7.7719}, {OT::Put, 100.0,  5.8069},
+        {OT::Call, 120.0,  1.8757}, {OT::Put, 120.0, 18.9347},
+    };
+
+    auto model = asianModel();
+    for (const auto& c : cases) {
+        products::AsianOption opt(std::make_unique<core::PlainVanillaPayoff>(c.type, c.K), 1.0);
+
+        opt.setPricingEngine(std::make_shared<engines::AsianOptionAnalyticEngine>(model, AA::Curran));
+        CHECK(std::abs(opt.NPV() - c.mc) < 5e-3);
+
+        // Levy et Turnbull–Wakeman : ajustement log-normal, moins précis
+        opt.setPricingEngine(std::make_shared<engines::AsianOptionAnalyticEngine>(model, AA::Levy));
+        CHECK(std::abs(opt.NPV() - c.mc) < 0.1);
+        opt.setPricingEngine(std::make_shared<engines::AsianOptionAnalyticEngine>(model, AA::TurnbullWakeman));
+        CHECK(std::abs(opt.NPV() - c.mc) < 0.1);
+    }
+}
+
+TEST_CASE("AsianFormula - un seul fixing = Black-Scholes") {
+    double r = 0.05, q = 0.01, sigma = 0.3, T = 0.7;
+    double F = 100.0 * std::exp((r - q) * T);
+    double bs = utils::blackForward(F, 105.0, sigma * std::sqrt(T), core::OptionType::Call);
+
+    std::vector<double> t{T};
+    auto call = core::OptionType::Call;
+    CHECK(utils::levyAsianUndiscounted(100.0, 105.0, r, q, sigma, t, call) == doctest::Approx(bs));
+    CHECK(utils::turnbullWakemanAsianUndiscounted(100.0, 105.0, r, q, sigma, t, call) == doctest::Approx(bs));
+    CHECK(utils::curranAsianUndiscounted(100.0, 105.0, r, q, sigma, t, call) == doctest::Approx(bs));
+}
+
+TEST_CASE("AsianOption - calendrier et fixings constatés") {
+    using OT = core::OptionType;
+    auto model = asianModel();
+
+    // 4 fixings constatés sur 12, restent les 8 derniers mois
+    std::vector<double> t = monthlyFixings();
+    t.erase(t.begin(), t.begin() + 4);
+    std::vector<double> past{95.0, 102.0, 110.0, 104.0};
+
+    products::AsianOption call(std::make_unique<core::PlainVanillaPayoff>(OT::Call, 100.0),
+                               1.0, t, products::AverageType::Arithmetic, past);
+    engines::MonteCarloSettings settings;
+    settings.controlVariate = true;
+    call.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(model, 50000, 1, 3UL, settings));
+    auto res = call.results();
+
+    call.setPricingEngine(std::make_shared<engines::AsianOptionAnalyticEngine>(model));
+    CHECK(std::abs(call.NPV() - res.npv) < 5e-3 + 4.0 * res.stdError);
+
+    SUBCASE("moyenne géométrique : formule exacte") {
+        products::AsianOption geo(std::make_unique<core::PlainVanillaPayoff>(OT::Call, 100.0),
+                                  1.0, t, products::AverageType::Geometric, past);
+        geo.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(model, 50000, 1, 3UL));
+        auto mc = geo.results();
+        geo.setPricingEngine(std::make_shared<engines::AsianOptionAnalyticEngine>(model));
+        CHECK(std::abs(geo.NPV() - mc.npv) < 4.0 * mc.stdError);
+    }
+
+    SUBCASE("strike effectif négatif : call linéaire, put nul") {
+        std::vector<double> rich(11, 250.0);
+        std::vector<double> last{1.0};
+        products::AsianOption c(std::make_unique<core::PlainVanillaPayoff>(OT::Call, 100.0),
+                                1.0, last, products::AverageType::Arithmetic, rich);
+        products::AsianOption p(std::make_unique<core::PlainVanillaPayoff>(OT::Put, 100.0),
+                                1.0, last, products::AverageType::Arithmetic, rich);
+        auto engine = std::make_shared<engines::AsianOptionAnalyticEngine>(model);
+        c.setPricingEngine(engine);
+        p.setPricingEngine(engine);
+
+        double forward = (11.0 * 250.0 + 100.0 * std::exp(0.04)) / 12.0;
+        CHECK(c.NPV() == doctest::Approx(std::exp(-0.05) * (forward - 100.0)));
+        CHECK(p.NPV() == 0.0);
+    }
+
+    SUBCASE("tous les fixings constatés : payoff connu") {
+        std::vector<double> none;
+        products::AsianOption done(std::make_unique<core::PlainVanillaPayoff>(OT::Call, 100.0),
+                                   1.0, none, products::AverageType::Arithmetic, past);
+        done.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(model, 1000, 1));
+        double expected = std::exp(-0.05) * (411.0 / 4.0 - 100.0);
+        CHECK(done.NPV() == doctest::Approx(expected));
+        done.setPricingEngine(std::make_shared<engines::AsianOptionAnalyticEngine>(model));
+        CHECK(done.NPV() == doctest::Approx(expected));
+    }
+}
+
+TEST_CASE("AsianOption - calendrier invalide") {
+    auto payoff = [] { return std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0); };
+    CHECK_THROWS(products::AsianOption(payoff(), 1.0, {0.5, 0.5}));
+    CHECK_THROWS(products::AsianOption(payoff(), 1.0, {0.5, 1.5}));
+    CHECK_THROWS(products::AsianOption(payoff(), 1.0, {0.5}, products::AverageType::Arithmetic, {-1.0}));
+}
+
+TEST_CASE("EngineFactory - asiatique vanille en formule fermée") {
+    auto irModel = std::shared_ptr<models::BlackIRModel>();
+    core::EngineFactory factory(asianModel(), irModel);
+
+    products::AsianOption vanilla(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    auto engine = factory.createEngine(vanilla);
+    CHECK(dynamic_cast<const engines::AsianOptionAnalyticEngine*>(engine.get()));
+
+    products::AsianOption digital(
+        std::make_unique<core::DigitalPayoff>(core::OptionType::Call, 100.0, 10.0), 1.0);
+    engine = factory.createEngine(digital);
+    CHECK(dynamic_cast<const engines::AsianOptionMCEngine*>(engine.get()));
+
+    // le moteur à chemins partagés ne gère que la grille uniforme
+    engines::SharedPathMCEngine shared(asianModel(), 1.0, 12, 1000);
+    products::AsianOption scheduled(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0, monthlyFixings());
+    CHECK_THROWS(shared.add(scheduled));
+}
@@ -0,0 +1,143 @@
+#include "doctest/doctest.h"
+
+#include "market/MarketData.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "core/Payoff.hpp"
+#include "core/EngineFactory.hpp"
+#include "products/BarrierOption.hpp"
+#include "engines/BarrierOptionAnalyticEngine.hpp"
+#include "engines/BarrierOptionMCEngine.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace pricer;
+
+namespace {
+
+// Jeu de test de Haug : S=100, r=8%, q=4%, vol=25%, T=0.5, rebate 3
+std::shared_ptr<models::BlackScholesModel> haugModel() {
+    auto discountCurve = std::make_shared<market::YieldCurve>(0.08);
+    auto equityCurve   = std::make_shared<market::EquityCurve>(100.0, 0.04);
+    return std::make_shared<models::BlackScholesModel>(discountCurve, equityCurve, 0.25);
+}
+
+struct HaugCase {
+    products::BarrierType type;
+    core::OptionType option;
+    double barrier;
+    double expected[3];  // K = 90, 100, 110
+};
+
+} 
+
+TEST_CASE("BarrierOptionAnalyticEngine - table de Haug (rebate inclus)") {
+    using BT = products::BarrierType;
+    using OT = core::OptionType;
+
+    const HaugCase cases[] = {
+        {BT::DownAndOut, OT::Call,  95.0, {9.0246, 6.7924, 4.8759}},
+        {BT::UpAndOut,   OT::Call, 105.0, {2.6789, 2.3580, 2.3453}},
+        {BT::DownAndIn,  OT::Call,  95.0, {7.7627, 4.0109, 2.0576}},
+        {BT::UpAndIn,    OT::Call, 105.0, {14.1112, 8.4482, 4.5910}},
+        {BT::DownAndOut, OT::Put,   95.0, {2.2798, 2.2947, 2.6252}},
+        {BT::UpAndOut,   OT::Put,  105.0, {3.7760, 5.4932, 7.5187}},
+        {BT::DownAndIn,  OT::Put,   95.0, {2.9586, 6.5677, 11.9752}},
+        {BT::UpAndIn,    OT::Put,  105.0, {1.4653, 3.3721, 7.0846}},
+    };
+
+    auto engine = std::make_shared<engines::BarrierOptionAnalyticEngine>(haugModel());
+    const double strikes[3] = {90.0, 100.0, 110.0};
+
+    for (const auto& c : cases) {
+        for (int k = 0; k < 3; ++k) {
+            products::BarrierOption opt(
+                std::make_unique<core::PlainVanillaPayoff>(c.option, strikes[k]),
+                0.5, c.barrier, c.type, 3.0);
+            opt.setPricingEngine(engine);
+            CHECK(opt.NPV() == doctest::Approx(c.expected[k]).epsilon(1e-4));
+        }
+    }
+}
+
+TEST_CASE("BarrierOptionAnalyticEngine - barrière déjà franchie") {
+    auto engine = std::make_shared<engines::BarrierOptionAnalyticEngine>(haugModel());
+
+    products::BarrierOption out(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        0.5, 99.0, products::BarrierType::UpAndOut, 3.0);
+    out.setPricingEngine(engine);
+    CHECK(out.NPV() == doctest::Approx(3.0));
+
+    // knock-in activé = vanille ; in + out = vanille + rebates
+    products::BarrierOption in(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        0.5, 99.0, products::BarrierType::UpAndIn);
+    in.setPricingEngine(engine);
+    products::BarrierOption inLive(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        0.5, 130.0, products::BarrierType::UpAndIn);
+    products::BarrierOption outLive(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        0.5, 130.0, products::BarrierType::UpAndOut);
+    inLive.setPricingEngine(engine);
+    outLive.setPricingEngine(engine);
+    CHECK(inLive.NPV() + outLive.NPV() == doctest::Approx(in.NPV()).epsilon(1e-12));
+}
+
+TEST_CASE("BarrierOptionAnalyticEngine - rebate au contact et taux négatif") {
+    // r = -2 %, b = sigma^2 / 2 : mu = 0 et mu^2 + 2r/sigma^2 = -1
+    auto model = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(-0.02),
+        std::make_shared<market::EquityCurve>(100.0, -0.04), 0.2);
+    auto engine = std::make_shared<engines::BarrierOptionAnalyticEngine>(model);
+
+    auto barrier = [&](products::BarrierType type, double rebate) {
+        products::BarrierOption opt(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+            1.0, 120.0, type, rebate);
+        opt.setPricingEngine(engine);
+        return opt.NPV();
+    };
+    CHECK_THROWS_AS(barrier(products::BarrierType::UpAndOut, 3.0), std::runtime_error);
+    // sans rebate au contact : formule définie
+    CHECK(std::isfinite(barrier(products::BarrierType::UpAndOut, 0.0)));
+    CHECK(std::isfinite(barrier(products::BarrierType::UpAndIn, 3.0)));
+}
+
+TEST_CASE("BarrierOptionMCEngine - rebate en surveillance continue") {
+    engines::MonteCarloSettings settings;
+    settings.barrierMonitoring = engines::BarrierMonitoring::Continuous;
+
+    using BT = products::BarrierType;
+    for (auto type : {BT::DownAndOut, BT::DownAndIn}) {
+        products::BarrierOption opt(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+            0.5, 95.0, type, 3.0);
+
+        opt.setPricingEngine(std::make_shared<engines::BarrierOptionAnalyticEngine>(haugModel()));
+        double analytic = opt.NPV();
+
+        opt.setPricingEngine(std::make_shared<engines::BarrierOptionMCEngine>(
+            haugModel(), 100000, 25, 4UL, settings));
+        auto res = opt.results();
+        CHECK(std::abs(res.npv - analytic) < 4.0 * res.stdError);
+    }
+}
+
+TEST_CASE("EngineFactory - barrière vanille en formule fermée") {
+    auto irModel = std::shared_ptr<models::BlackIRModel>();
+    core::EngineFactory factory(haugModel(), irModel);
+
+    products::BarrierOption vanilla(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        0.5, 95.0, products::BarrierType::DownAndOut, 3.0);
+    auto engine = factory.createEngine(vanilla);
+    CHECK(dynamic_cast<const engines::BarrierOptionAnalyticEngine*>(engine.get()));
+
+    products::BarrierOption digital(
+        std::make_unique<core::DigitalPayoff>(core::OptionType::Call, 100.0, 10.0),
+        0.5, 95.0, products::BarrierType::DownAndOut);
+    engine = factory.createEngine(digital);
+    CHECK(dynamic_cast<const engines::BarrierOptionMCEngine*>(engine.get()));
+}
@@ -1,7 +1,9 @@
 #include "doctest/doctest.h"
 
 #include "utils/BlackFormula.hpp"
-#include <algorithm>    
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 
 using namespace pricer;
@@ -23,3 +25,109 @@ TEST_CASE("blackForward intrinsic when stdDev=0") {
     CHECK(call == doctest::Approx(std::max(F - K, 0.0)));
     CHECK(put  == doctest::Approx(std::max(K - F, 0.0)));
 }
+
+TEST_CASE("inverseNormalCdf inverse normalCdf") {
+    for (double p : {1e-12, 1e-6, 0.01, 0.3, 0.5, 0.8, 0.99, 1.0 - 1e-9}) {
+        double x = utils::inverseNormalCdf(p);
+        CHECK(utils::normalCdf(x) == doctest::Approx(p).epsilon(1e-12));
+    }
+    CHECK(utils::inverseNormalCdf(0.5) == doctest::Approx(0.0));
+}
+
+TEST_CASE("blackForwardBatch = blackForward scalaire") {
+    // Grille forwards x strikes x vols x types, avec cas dégénérés
+    std::vector<double> F, K, sd, df;
+    std::vector<core::OptionType> types;
+    for (double f : {0.01, 0.035, 1.0, 80.0, 100.0, 150.0}) {
+        for (double m : {0.3, 0.7, 0.95, 1.0, 1.05, 1.5, 3.0}) {
+            for (double s : {0.0, 1e-4, 0.05, 0.2, 0.8, 2.5}) {
+                for (auto t : {core::OptionType::Call, core::OptionType::Put}) {
+                    F.push_back(f);
+                    K.push_back(f * m);
+                    sd.push_back(s);
+                    types.push_back(t);
+                    df.push_back(0.9 + 0.001 * static_cast<double>(F.size() % 50));
+                }
+            }
+        }
+    }
+    std::vector<double> out(F.size());
+
+    for (auto level : {utils::SimdLevel::Scalar, utils::SimdLevel::AVX2, utils::SimdLevel::AVX512}) {
+        CAPTURE(utils::simdLevelName(level));
+        utils::blackForwardBatch(F, K, sd, types, df, out, level);
+        for (std::size_t i = 0; i < F.size(); ++i) {
+            double ref = df[i] * utils::blackForward(F[i], K[i], sd[i], types[i]);
+            // écart rapporté au forward (la différence call-put est en F)
+            CHECK(out[i] == doctest::Approx(ref).epsilon(1e-14).scale(F[i] + K[i]));
+        }
+    }
+
+    std::vector<double> shorter(F.size() - 1);
+    CHECK_THROWS(utils::blackForwardBatch(F, K, sd, types, df, shorter));
+}
+
+TEST_CASE("impliedBlackStdDev inverse blackForward") {
+    // Grille moneyness x vol x type, ailes comprises
+    for (double F : {0.02, 1.0, 100.0}) {
+        for (double m : {0.2, 0.6, 0.9, 1.0, 1.1, 1.7, 5.0}) {
+            for (double s : {0.01, 0.1, 0.3, 1.0, 2.5}) {
+                for (auto t : {core::OptionType::Call, core::OptionType::Put}) {
+                    double K = F * m;
+                    double price = utils::blackForward(F, K, s, t);
+                    CAPTURE(F); CAPTURE(m); CAPTURE(s);
+                    double implied = utils::impliedBlackStdDev(price, F, K, t);
+                    // vol retrouvée si le prix la détermine : option hors de
+                    // la monnaie (pas d'annulation avec l'intrinsèque) et prix
+                    // au-dessus du bruit d'arrondi de blackForward
+                    bool otm = (t == core::OptionType::Call) ? K >= F : K <= F;
+                    if (otm && price / std::sqrt(F * K) > 1e-8) {
+                        CHECK(implied == doctest::Approx(s).epsilon(1e-10));
+                    }
+                    CHECK(utils::blackForward(F, K, implied, t)
+                          == doctest::Approx(price).epsilon(1e-12).scale(F));
+                }
+            }
+        }
+    }
+
+    // A la monnaie : inversion exacte, vol minuscule comprise
+    for (double s : {1e-7, 1e-3, 0.2, 1.0, 4.0}) {
+        CAPTURE(s);
+        for (auto t : {core::OptionType::Call, core::OptionType::Put}) {
+            double price = utils::blackForward(100.0, 100.0, s, t);
+            CHECK(utils::impliedBlackStdDev(price, 100.0, 100.0, t) == doctest::Approx(s).epsilon(1e-12));
+        }
+    }
+
+    CHECK(utils::impliedBlackStdDev(0.0, 100.0, 120.0, core::OptionType::Call) == 0.0);
+    CHECK(utils::impliedBlackStdDev(20.0, 100.0, 80.0, core::OptionType::Call) == 0.0);
+    CHECK_THROWS(utils::impliedBlackStdDev(-1.0, 100.0, 120.0, core::OptionType::Call));
+    CHECK_THROWS(utils::impliedBlackStdDev(19.0, 100.0, 80.0, core::OptionType::Call));
+    CHECK_THROWS(utils::impliedBlackStdDev(100.0, 100.0, 80.0, core::OptionType::Call));
+    CHECK_THROWS(utils::impliedBlackStdDev(80.0, 100.0, 80.0, core::OptionType::Put));
+}
+
+TEST_CASE("impliedBlackStdDevBatch : prix actualisés, NaN hors bornes") {
+    std::vector<double> F{100.0, 100.0, 100.0, 0.03};
+    std::vector<double> K{90.0, 100.0, 130.0, 0.025};
+    std::vector<double> sd{0.2, 0.35, 0.5, 0.12};
+    std::vector<double> df{0.97, 0.95, 0.9, 0.99};
+    std::vector<core::OptionType> types{core::OptionType::Put, core::OptionType::Call,
+                                        core::OptionType::Call, core::OptionType::Put};
+    std::vector<double> prices(F.size()), out(F.size());
+    utils::blackForwardBatch(F, K, sd, types, df, prices);
+    prices.push_back(-1.0);
+    F.push_back(100.0); K.push_back(100.0); df.push_back(1.0);
+    types.push_back(core::OptionType::Call);
+    out.push_back(0.0);
+
+    utils::impliedBlackStdDevBatch(prices, F, K, types, df, out);
+    for (std::size_t i = 0; i < sd.size(); ++i) {
+        CHECK(out[i] == doctest::Approx(sd[i]).epsilon(1e-12));
+    }
+    CHECK(std::isnan(out.back()));
+
+    std::vector<double> shorter(out.size() - 1);
+    CHECK_THROWS(utils::impliedBlackStdDevBatch(prices, F, K, types, df, shorter));
+}
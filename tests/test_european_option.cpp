@@ -5,6 +5,21 @@
 #include "core/Payoff.hpp"
 #include "products/EuropeanOption.hpp"
 #include "engines/EuropeanOptionBSEngine.hpp"
+#include "products/DigitalOption.hpp"
+#include "engines/DigitalOptionBSEngine.hpp"
+#include "core/EngineFactory.hpp"
+#include "models/BlackIRModel.hpp"
+#include "products/CapFloor.hpp"
+#include "engines/CapFloorEngines.hpp"
+#include "products/VanillaBook.hpp"
+#include "engines/VanillaBookEngine.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace pricer;
 
@@ -37,3 +52,403 @@ TEST_CASE("EuropeanOptionBSEngine - ATM call") {
     // Valeur de référence ~8.9 (ordre de grandeur)
     CHECK(price == doctest::Approx(8.9).epsilon(1e-2));
 }
+
+namespace {
+
+// Prix par re-pricing complet avec des données de marché choquées
+struct BsInputs { double S, r, q, vol, T; };
+
+std::shared_ptr<models::BlackScholesModel> bsModel(const BsInputs& in) {
+    return std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(in.r),
+        std::make_shared<market::EquityCurve>(in.S, in.q), in.vol);
+}
+
+// Grecques analytiques comparées aux différences finies centrées
+void checkGreeksAgainstBumps(const std::function<core::PricingResults(const BsInputs&)>& price,
+                             const BsInputs& in) {
+    auto res = price(in);
+    REQUIRE(res.greeks);
+    const auto& g = *res.greeks;
+
+    auto bumped = [&](double BsInputs::*field, double h) {
+        BsInputs up = in, down = in;
+        up.*field += h;
+        down.*field -= h;
+        return std::make_pair(price(up).npv, price(down).npv);
+    };
+
+    double hS = 1e-3 * in.S;
+    auto [sUp, sDown] = bumped(&BsInputs::S, hS);
+    CHECK(g.delta == doctest::Approx((sUp - sDown) / (2.0 * hS)).epsilon(1e-6));
+    CHECK(g.gamma == doctest::Approx((sUp - 2.0 * res.npv + sDown) / (hS * hS)).epsilon(1e-4));
+
+    auto [vUp, vDown] = bumped(&BsInputs::vol, 1e-5);
+    CHECK(g.vega == doctest::Approx((vUp - vDown) / 2e-5).epsilon(1e-6));
+    auto [rUp, rDown] = bumped(&BsInputs::r, 1e-5);
+    CHECK(g.rho == doctest::Approx((rUp - rDown) / 2e-5).epsilon(1e-6));
+    auto [qUp, qDown] = bumped(&BsInputs::q, 1e-5);
+    CHECK(g.dividendRho == doctest::Approx((qUp - qDown) / 2e-5).epsilon(1e-6));
+    // theta : maturité résiduelle qui diminue
+    auto [tUp, tDown] = bumped(&BsInputs::T, 1e-5);
+    CHECK(g.theta == doctest::Approx(-(tUp - tDown) / 2e-5).epsilon(1e-6));
+}
+
+} 
+
+TEST_CASE("EuropeanOptionBSEngine - grecques analytiques") {
+    for (auto type : {core::OptionType::Call, core::OptionType::Put}) {
+        for (double K : {80.0, 100.0, 125.0}) {
+            CAPTURE(K);
+            auto price = [&](const BsInputs& in) {
+                products::EuropeanOption opt(std::make_unique<core::PlainVanillaPayoff>(type, K), in.T);
+                opt.setPricingEngine(std::make_shared<engines::EuropeanOptionBSEngine>(bsModel(in)));
+                return opt.results();
+            };
+            checkGreeksAgainstBumps(price, {100.0, 0.03, 0.015, 0.25, 1.5});
+
+            // même NPV que le prix seul
+            BsInputs in{100.0, 0.03, 0.015, 0.25, 1.5};
+            products::EuropeanOption opt(std::make_unique<core::PlainVanillaPayoff>(type, K), in.T);
+            opt.setPricingEngine(std::make_shared<engines::EuropeanOptionBSEngine>(bsModel(in)));
+            CHECK(opt.results().npv == doctest::Approx(opt.NPV()).epsilon(1e-14));
+        }
+    }
+
+    // Call ATM sans dividende : grecques de manuel
+    BsInputs in{100.0, 0.02, 0.0, 0.2, 1.0};
+    products::EuropeanOption call(std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    call.setPricingEngine(std::make_shared<engines::EuropeanOptionBSEngine>(bsModel(in)));
+    auto g = *call.results().greeks;
+    constexpr double kInvSqrt2Pi = 0.39894228040143267794;
+    double d1 = (0.02 + 0.02) / 0.2;
+    CHECK(g.delta == doctest::Approx(0.5 * std::erfc(-d1 / std::sqrt(2.0))));
+    CHECK(g.vega == doctest::Approx(100.0 * std::exp(-0.5 * d1 * d1) * kInvSqrt2Pi));
+}
+
+TEST_CASE("DigitalOptionBSEngine - grecques analytiques") {
+    for (auto type : {core::OptionType::Call, core::OptionType::Put}) {
+        for (double K : {85.0, 100.0, 115.0}) {
+            CAPTURE(K);
+            auto price = [&](const BsInputs& in) {
+                products::DigitalOption opt(std::make_unique<core::DigitalPayoff>(type, K, 10.0), in.T);
+                opt.setPricingEngine(std::make_shared<engines::DigitalOptionBSEngine>(bsModel(in)));
+                return opt.results();
+            };
+            checkGreeksAgainstBumps(price, {100.0, 0.03, 0.015, 0.25, 1.5});
+        }
+    }
+}
+
+TEST_CASE("calculateBatch = calculate produit par produit") {
+    auto model = bsModel({100.0, 0.03, 0.015, 0.25, 1.0});
+    auto engine = std::make_shared<engines::EuropeanOptionBSEngine>(model);
+    auto digitalEngine = std::make_shared<engines::DigitalOptionBSEngine>(model);
+
+    // vanilles (dont une échue), digitales ; quelques européennes échues à
+    // payoff digital passent par le repli priceImpl
+    std::vector<std::unique_ptr<products::EuropeanOption>> book;
+    std::vector<std::unique_ptr<products::DigitalOption>> digitals;
+    for (int i = 0; i < 600; ++i) {
+        auto type = (i % 2) ? core::OptionType::Call : core::OptionType::Put;
+        double K = 70.0 + 0.1 * i;
+        double T = (i == 7) ? 0.0 : 0.1 + 0.01 * i;
+        if (i % 50 == 3) {
+            book.push_back(std::make_unique<products::EuropeanOption>(
+                std::make_unique<core::DigitalPayoff>(type, K, 5.0), 0.0));
+        } else {
+            book.push_back(std::make_unique<products::EuropeanOption>(
+                std::make_unique<core::PlainVanillaPayoff>(type, K), T));
+        }
+        digitals.push_back(std::make_unique<products::DigitalOption>(
+            std::make_unique<core::DigitalPayoff>(type, K, 5.0), T));
+    }
+
+    std::vector<const core::Instrument*> instruments, digitalInstruments;
+    for (const auto& o : book) instruments.push_back(o.get());
+    for (const auto& o : digitals) digitalInstruments.push_back(o.get());
+    std::vector<double> out(book.size());
+
+    engine->calculateBatch(instruments, out);
+    for (std::size_t i = 0; i < book.size(); ++i) {
+        CAPTURE(i);
+        CHECK(out[i] == doctest::Approx(engine->calculate(*book[i])).epsilon(1e-13).scale(1.0));
+    }
+
+    digitalEngine->calculateBatch(digitalInstruments, out);
+    for (std::size_t i = 0; i < digitals.size(); ++i) {
+        CHECK(out[i] == doctest::Approx(digitalEngine->calculate(*digitals[i])).epsilon(1e-13));
+    }
+
+    std::vector<double> shorter(out.size() - 1);
+    CHECK_THROWS(engine->calculateBatch(digitalInstruments, out));
+    CHECK_THROWS(digitalEngine->calculateBatch(digitalInstruments, shorter));
+
+    // Actualisation et forwards par lot = appels unitaires du modèle
+    std::vector<double> times{0.0, 0.25, 1.0, 7.5};
+    std::vector<double> df(times.size()), fwd(times.size());
+    model->discount(times, df);
+    model->forward(times, fwd);
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        CHECK(df[i] == doctest::Approx(model->discount(times[i])).epsilon(1e-15));
+        CHECK(fwd[i] == doctest::Approx(model->forward(times[i])).epsilon(1e-15));
+    }
+    CHECK_THROWS(model->discount(times, shorter));
+}
+
+namespace {
+
+// Produit dérivé non enregistré : prend la règle de sa classe de base
+class QuantoEuropeanOption : public products::EuropeanOption {
+public:
+    using products::EuropeanOption::EuropeanOption;
+};
+
+// Deuxième niveau : prend la règle de la base enregistrée la plus dérivée
+class CompoQuantoOption : public QuantoEuropeanOption {
+public:
+    using QuantoEuropeanOption::QuantoEuropeanOption;
+};
+
+class UnknownProduct : public core::Instrument {};
+
+} 
+
+TEST_CASE("EngineFactory - table par type et moteurs partagés") {
+    auto irModel = std::make_shared<models::BlackIRModel>(
+        std::make_shared<market::YieldCurve>(0.02), 0.25);
+    core::EngineFactory factory(bsModel({100.0, 0.03, 0.0, 0.2, 1.0}), irModel);
+
+    products::EuropeanOption a(std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    products::EuropeanOption b(std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Put, 90.0), 2.0);
+    auto engineA = factory.createEngine(a);
+    CHECK(dynamic_cast<const engines::EuropeanOptionBSEngine*>(engineA.get()));
+    CHECK(factory.createEngine(b).get() == engineA.get());
+
+    QuantoEuropeanOption derived(std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    CHECK(factory.createEngine(derived).get() == engineA.get());
+
+    // Floorlet dérive de Caplet : même moteur caplet
+    products::Caplet caplet(1e6, 0.03, 0.028, 0.5, 1.0, 0.5);
+    products::Floorlet floorlet(1e6, 0.03, 0.028, 0.5, 1.0, 0.5);
+    auto capletEngine = factory.createEngine(caplet);
+    CHECK(dynamic_cast<const engines::CapletBlackEngine*>(capletEngine.get()));
+    CHECK(factory.createEngine(floorlet).get() == capletEngine.get());
+
+    CHECK_THROWS(factory.createEngine(UnknownProduct{}));
+
+    // Table figée après le premier createEngine
+    auto digital = [](const core::EngineFactory& f, const core::Instrument&) {
+        return f.shared<engines::DigitalOptionBSEngine>(f.equityModel());
+    };
+    CHECK_THROWS_AS(factory.registerEngine<QuantoEuropeanOption>(digital), std::runtime_error);
+
+    // Règle d'un type précis, parent déclaré : la hiérarchie à deux
+    // niveaux prend la règle de QuantoEuropeanOption, pas d'EuropeanOption
+    CompoQuantoOption compo(std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    core::EngineFactory refined(bsModel({100.0, 0.03, 0.0, 0.2, 1.0}), irModel);
+    refined.registerEngine<QuantoEuropeanOption, products::EuropeanOption>(digital);
+    CHECK(dynamic_cast<const engines::DigitalOptionBSEngine*>(refined.createEngine(derived).get()));
+    CHECK(dynamic_cast<const engines::DigitalOptionBSEngine*>(refined.createEngine(compo).get()));
+    CHECK(dynamic_cast<const engines::EuropeanOptionBSEngine*>(refined.createEngine(a).get()));
+
+    // Parent non déclaré : EuropeanOption et QuantoEuropeanOption acceptent
+    // compo sans lien connu, règle ambiguë
+    core::EngineFactory unrelated(bsModel({100.0, 0.03, 0.0, 0.2, 1.0}), irModel);
+    unrelated.registerEngine<QuantoEuropeanOption>(digital);
+    CHECK(dynamic_cast<const engines::DigitalOptionBSEngine*>(unrelated.createEngine(derived).get()));
+    CHECK_THROWS_AS(unrelated.createEngine(compo), std::runtime_error);
+}
+
+namespace {
+
+// Compte les appels réels au moteur
+class CountingBSEngine : public engines::EuropeanOptionBSEngine {
+public:
+    using engines::EuropeanOptionBSEngine::EuropeanOptionBSEngine;
+    mutable int calls = 0;
+
+protected:
+    double priceImpl(const core::Instrument& inst) const override {
+        ++calls;
+        return engines::EuropeanOptionBSEngine::priceImpl(inst);
+    }
+};
+
+} 
+
+TEST_CASE("Instrument - NPV en cache, invalidé par le marché") {
+    auto rates  = std::make_shared<market::YieldCurve>(0.03);
+    auto equity = std::make_shared<market::EquityCurve>(100.0, 0.0);
+    auto model  = std::make_shared<models::BlackScholesModel>(rates, equity, 0.2);
+    auto engine = std::make_shared<CountingBSEngine>(model);
+
+    products::EuropeanOption call(std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    call.setPricingEngine(engine);
+
+    double p0 = call.NPV();
+    CHECK(call.NPV() == p0);
+    CHECK(engine->calls == 1);
+
+    // chaque changement remonte courbe -> modèle -> moteur -> instrument
+    equity->setSpot(110.0);
+    double p1 = call.NPV();
+    CHECK(engine->calls == 2);
+    CHECK(p1 > p0);
+
+    model->setSigma(0.3);
+    double p2 = call.NPV();
+    CHECK(engine->calls == 3);
+    CHECK(p2 > p1);
+
+    rates->setRate(0.05);
+    CHECK(call.NPV() > p2);
+    CHECK(engine->calls == 4);
+
+    products::EuropeanOption fresh(std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    fresh.setPricingEngine(std::make_shared<engines::EuropeanOptionBSEngine>(
+        bsModel({110.0, 0.05, 0.0, 0.3, 1.0})));
+    CHECK(call.NPV() == doctest::Approx(fresh.NPV()));
+    CHECK(engine->calls == 4);
+
+    // nouveau moteur : cache vidé, l'ancien n'est plus suivi
+    auto other = std::make_shared<CountingBSEngine>(model);
+    call.setPricingEngine(other);
+    call.NPV();
+    CHECK(other->calls == 1);
+    model->setSigma(0.25);
+    call.NPV();
+    CHECK(other->calls == 2);
+    CHECK(engine->calls == 4);
+}
+
+namespace {
+
+// Compte ses update() ; peut se désinscrire pendant une notification
+class CountingObserver : public core::Observer {
+public:
+    explicit CountingObserver(std::shared_ptr<core::Observable> observable, bool once = false)
+        : observable_(std::move(observable)), once_(once) { registerWith(observable_); }
+    ~CountingObserver() override { unregisterAll(); }
+
+    void update() override {
+        ++updates;
+        if (once_) unregisterWith(observable_);
+    }
+
+    std::atomic<int> updates{0};
+
+private:
+    std::shared_ptr<core::Observable> observable_;
+    bool once_;
+};
+
+} 
+
+TEST_CASE("Observable - notifications et destructions sur des threads différents") {
+    auto equity = std::make_shared<market::EquityCurve>(100.0, 0.0);
+    auto model  = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.03), equity, 0.2);
+    auto engine = std::make_shared<engines::EuropeanOptionBSEngine>(model);
+
+    // Ticks pendant que des instruments sont créés, changent de moteur et
+    // sont détruits : aucun update() sur un observateur détruit
+    std::atomic<bool> done{false};
+    std::thread ticker([&] {
+        for (int i = 0; !done; ++i) {
+            equity->setSpot(100.0 + i % 10);
+        }
+    });
+    for (int i = 0; i < 2000; ++i) {
+        auto opt = std::make_unique<products::EuropeanOption>(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+        opt->setPricingEngine(engine);
+        if (i % 2) {
+            opt->setPricingEngine(std::make_shared<engines::EuropeanOptionBSEngine>(model));
+        }
+    }
+    done = true;
+    ticker.join();
+
+    // Désinscription pendant sa propre notification, puis plus d'appel
+    CountingObserver once(equity, true);
+    CountingObserver always(equity);
+    equity->setSpot(101.0);
+    equity->setSpot(102.0);
+    CHECK(once.updates == 1);
+    CHECK(always.updates == 2);
+}
+
+TEST_CASE("VanillaBook - prix par colonnes = moteurs objet") {
+    using OT = core::OptionType;
+    auto eq1 = bsModel({100.0, 0.03, 0.01, 0.2, 1.0});
+    auto eq2 = bsModel({45.0, 0.01, 0.0, 0.35, 1.0});
+
+    // Strikes, maturités (dont échues) et types variés, deux sous-jacents
+    products::VanillaBook book;
+    for (int i = 0; i < 20000; ++i) {
+        std::uint32_t u = i % 3 == 0 ? 1 : 0;
+        double S = u ? 45.0 : 100.0;
+        double K = S * (0.5 + 0.001 * (i % 1000));
+        double T = (i % 97 == 0) ? 0.0 : 0.01 * (1 + i % 500);
+        OT type  = (i % 2) ? OT::Put : OT::Call;
+        if (i % 5 == 0) {
+            book.addDigital(type, K, T, 10.0, u);
+        } else {
+            book.addEuropean(type, K, T, u);
+        }
+    }
+
+    engines::VanillaBookEngine engine({eq1, eq2});
+    std::vector<double> prices(book.size()), threaded(book.size());
+    engine.price(book, prices);
+    engine.price(book, threaded, 0);
+
+    auto instruments = book.toInstruments();
+    auto european1 = std::make_shared<engines::EuropeanOptionBSEngine>(eq1);
+    auto european2 = std::make_shared<engines::EuropeanOptionBSEngine>(eq2);
+    auto digital1  = std::make_shared<engines::DigitalOptionBSEngine>(eq1);
+    auto digital2  = std::make_shared<engines::DigitalOptionBSEngine>(eq2);
+    for (std::size_t i = 0; i < book.size(); ++i) {
+        bool second = book.underlyings()[i] == 1;
+        if (book.kinds()[i] == products::VanillaKind::Digital) {
+            instruments[i]->setPricingEngine(second ? digital2 : digital1);
+        } else {
+            instruments[i]->setPricingEngine(second ? european2 : european1);
+        }
+        double ref = instruments[i]->NPV();
+        CHECK(prices[i] == doctest::Approx(ref).epsilon(1e-12).scale(1.0));
+        CHECK(threaded[i] == prices[i]);
+    }
+
+    // aller-retour objets -> colonnes
+    std::vector<const core::Instrument*> ptrs;
+    for (const auto& inst : instruments) ptrs.push_back(inst.get());
+    auto back = products::VanillaBook::fromInstruments(ptrs, book.underlyings());
+    CHECK(back.size() == book.size());
+    CHECK(back.underlyings() == book.underlyings());
+    CHECK(back.strikes() == book.strikes());
+    CHECK(back.maturities() == book.maturities());
+    CHECK(back.types() == book.types());
+    CHECK(back.kinds() == book.kinds());
+    CHECK(back.payouts() == book.payouts());
+
+    std::vector<std::uint32_t> tooShort(3, 1);
+    CHECK_THROWS(products::VanillaBook::fromInstruments(ptrs, tooShort));
+    CHECK(products::VanillaBook::fromInstruments(ptrs).underlyings() == std::vector<std::uint32_t>(ptrs.size(), 0));
+}
+
+TEST_CASE("VanillaBook - erreurs") {
+    products::VanillaBook book;
+    products::EuropeanOption digitalPayoff(
+        std::make_unique<core::DigitalPayoff>(core::OptionType::Call, 100.0, 1.0), 1.0);
+    CHECK_THROWS(book.add(digitalPayoff));
+    CHECK(book.empty());
+
+    book.addEuropean(core::OptionType::Call, 100.0, 1.0, 2);
+    engines::VanillaBookEngine engine(bsModel({100.0, 0.03, 0.0, 0.2, 1.0}));
+    std::vector<double> out(1);
+    CHECK_THROWS(engine.price(book, out));   // sous-jacent 2 inconnu
+    std::vector<double> wrong(2);
+    CHECK_THROWS(engine.price(book, wrong));
+}
@@ -0,0 +1,509 @@
+#include "doctest/doctest.h"
+
+#include "market/MarketData.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "core/Payoff.hpp"
+#include "products/AsianOption.hpp"
+#include "products/BarrierOption.hpp"
+#include "products/EuropeanOption.hpp"
+#include "engines/AsianOptionMCEngine.hpp"
+#include "engines/BarrierOptionMCEngine.hpp"
+#include "engines/SharedPathMCEngine.hpp"
+#include "utils/BlackFormula.hpp"
+#include "utils/Sobol.hpp"
+#include "utils/Philox.hpp"
+#include "utils/Normal.hpp"
+#include "utils/BrownianBridge.hpp"
+#include "utils/AsianFormula.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace pricer;
+
+namespace {
+
+std::shared_ptr<models::BlackScholesModel> makeModel() {
+    auto discountCurve = std::make_shared<market::YieldCurve>(0.02);
+    auto equityCurve   = std::make_shared<market::EquityCurve>(100.0, 0.0);
+    return std::make_shared<models::BlackScholesModel>(
+        discountCurve, equityCurve, 0.20
+    );
+}
+
+double priceAsian(std::size_t nThreads) {
+    products::AsianOption asian(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0
+    );
+
+    engines::MonteCarloSettings settings;
+    settings.nThreads  = nThreads;
+    settings.blockSize = 256;
+
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 4000, 12, 1234UL, settings
+    ));
+    return asian.NPV();
+}
+
+double priceBarrier(std::size_t nThreads) {
+    products::BarrierOption opt(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0,
+        120.0,
+        products::BarrierType::UpAndOut
+    );
+
+    engines::MonteCarloSettings settings;
+    settings.nThreads  = nThreads;
+    settings.blockSize = 256;
+
+    opt.setPricingEngine(std::make_shared<engines::BarrierOptionMCEngine>(
+        makeModel(), 4000, 50, 5678UL, settings
+    ));
+    return opt.NPV();
+}
+
+} 
+
+TEST_CASE("AsianOptionMCEngine - prix indépendant du nombre de threads") {
+    double p1 = priceAsian(1);
+
+    CHECK(priceAsian(2) == p1);
+    CHECK(priceAsian(7) == p1);
+
+    // Ordre de grandeur d'un call asiatique ATM 1Y (~5.2)
+    CHECK(p1 == doctest::Approx(5.2).epsilon(0.1));
+}
+
+TEST_CASE("BarrierOptionMCEngine - prix indépendant du nombre de threads") {
+    double p1 = priceBarrier(1);
+
+    CHECK(priceBarrier(3) == p1);
+    CHECK(priceBarrier(16) == p1);
+    CHECK(p1 > 0.0);
+}
+
+TEST_CASE("SobolSequence - dimension 1 = van der Corput") {
+    utils::SobolSequence sobol(3);
+    std::vector<double> u(3);
+
+    sobol.skipTo(1);
+    sobol.next(u.data());
+    CHECK(u[0] == doctest::Approx(0.5));
+    sobol.next(u.data());
+    CHECK(u[0] == doctest::Approx(0.75));
+    sobol.next(u.data());
+    CHECK(u[0] == doctest::Approx(0.25));
+
+    // skipTo est cohérent avec l'avance séquentielle
+    utils::SobolSequence other(3);
+    other.skipTo(3);
+    std::vector<double> v(3);
+    other.next(v.data());
+    CHECK(v == u);
+}
+
+TEST_CASE("BrownianBridge - W(T) porté par le premier aléa") {
+    utils::BrownianBridge bridge(8);
+    std::vector<double> z(8, 0.0), dw(8);
+    z[0] = 1.0;
+
+    bridge.transform(z.data(), dw.data());
+
+    // W(1) = z0, réparti uniformément : chaque incrément normalisé vaut sqrt(1/8)
+    for (double x : dw) {
+        CHECK(x == doctest::Approx(std::sqrt(1.0 / 8.0)));
+    }
+}
+
+TEST_CASE("AsianOptionMCEngine - Sobol + pont brownien") {
+    products::AsianOption asian(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0
+    );
+
+    // Référence : Monte Carlo 2M chemins
+    double reference = 5.3786;
+
+    engines::MonteCarloSettings qmc;
+    qmc.generator = engines::RandomGenerator::Sobol;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 4096, 12, 99UL, qmc
+    ));
+    CHECK(asian.NPV() == doctest::Approx(reference).epsilon(5e-3));
+
+    // Réplications brouillées : reproductibles et indépendantes des threads
+    qmc.scrambledReplications = 8;
+    qmc.blockSize = 128;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 4096, 12, 99UL, qmc
+    ));
+    double scrambled = asian.NPV();
+    CHECK(scrambled == doctest::Approx(reference).epsilon(5e-3));
+
+    qmc.nThreads = 4;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 4096, 12, 99UL, qmc
+    ));
+    CHECK(asian.NPV() == scrambled);
+}
+
+TEST_CASE("geometricAsianUndiscounted - une seule date = Black-Scholes") {
+    double T = 1.0;
+    double geo = utils::geometricAsianUndiscounted(
+        100.0, 100.0, 0.02, 0.0, 0.20, {T}, core::OptionType::Call);
+
+    // Call européen ATM : ~8.916 actualisé
+    CHECK(geo * std::exp(-0.02 * T) == doctest::Approx(8.916).epsilon(1e-3));
+}
+
+TEST_CASE("AsianOptionMCEngine - antithétique et variable de contrôle") {
+    products::AsianOption asian(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0
+    );
+
+    // Référence : MC brut sur 2M chemins (erreur type ~0.005)
+    double reference = 5.3786;
+
+    engines::MonteCarloSettings vr;
+    vr.antithetic     = true;
+    vr.controlVariate = true;
+    vr.blockSize      = 500;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 2000, 12, 7UL, vr
+    ));
+    double controlled = asian.NPV();
+    CHECK(controlled == doctest::Approx(reference).epsilon(3e-3));
+
+    vr.nThreads = 3;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 2000, 12, 7UL, vr
+    ));
+    CHECK(asian.NPV() == controlled);
+}
+
+TEST_CASE("BarrierOptionMCEngine - surveillance continue par pont brownien") {
+    engines::MonteCarloSettings settings;
+    settings.barrierMonitoring = engines::BarrierMonitoring::Continuous;
+
+    // Références analytiques (barrière continue, S0=100, K=100, B=120)
+    struct Case { products::BarrierType type; double expected; };
+    for (auto c : {Case{products::BarrierType::UpAndOut, 1.1410},
+                   Case{products::BarrierType::UpAndIn,  7.7750}}) {
+        products::BarrierOption opt(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+            1.0, 120.0, c.type
+        );
+        opt.setPricingEngine(std::make_shared<engines::BarrierOptionMCEngine>(
+            makeModel(), 40000, 10, 11UL, settings
+        ));
+        CHECK(opt.NPV() == doctest::Approx(c.expected).epsilon(2e-2));
+    }
+}
+
+TEST_CASE("Monte Carlo - erreur type et arrêt sur erreur cible") {
+    products::AsianOption asian(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0
+    );
+
+    engines::MonteCarloSettings plain;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 20000, 12, 3UL, plain
+    ));
+    auto full = asian.results();
+    CHECK(full.paths == 20000);
+    CHECK(full.npv == asian.NPV());
+    // écart-type du payoff actualisé ~7.3
+    CHECK(full.stdError == doctest::Approx(7.3 / std::sqrt(20000.0)).epsilon(0.1));
+
+    engines::MonteCarloSettings adaptive;
+    adaptive.targetStdError = 0.1;
+    adaptive.batchPaths     = 1024;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 1000000, 12, 3UL, adaptive
+    ));
+    auto early = asian.results();
+    CHECK(early.stdError <= 0.1);
+    CHECK(early.paths < 20000);
+
+    // Sobol brouillé : erreur estimée sur les réplications
+    engines::MonteCarloSettings rqmc;
+    rqmc.generator = engines::RandomGenerator::Sobol;
+    rqmc.scrambledReplications = 16;
+    asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+        makeModel(), 16384, 12, 3UL, rqmc
+    ));
+    auto q = asian.results();
+    CHECK(q.stdError > 0.0);
+    CHECK(q.stdError < full.stdError);
+}
+
+TEST_CASE("SharedPathMCEngine - un seul jeu de chemins pour tout le livre") {
+    auto model = makeModel();
+    engines::MonteCarloSettings settings;
+    settings.blockSize = 256;
+
+    auto shared = std::make_shared<engines::SharedPathMCEngine>(
+        model, 1.0, 12, 4000, 1234UL, settings
+    );
+
+    std::vector<std::unique_ptr<products::AsianOption>> asians;
+    for (double K : {90.0, 100.0, 110.0}) {
+        asians.push_back(std::make_unique<products::AsianOption>(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, K), 1.0));
+    }
+    products::BarrierOption uo(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0, 120.0, products::BarrierType::UpAndOut);
+    products::BarrierOption ui(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0, 120.0, products::BarrierType::UpAndIn);
+    products::EuropeanOption call6m(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 0.5);
+
+    for (auto& a : asians) shared->add(*a);
+    shared->add(uo);
+    shared->add(ui);
+    shared->add(call6m);
+    CHECK(shared->size() == 6);
+
+    // Mêmes aléas que les moteurs dédiés sur la même grille
+    for (auto& a : asians) {
+        a->setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+            model, 4000, 12, 1234UL, settings));
+        double dedicated = a->NPV();
+        a->setPricingEngine(shared);
+        CHECK(a->NPV() == doctest::Approx(dedicated).epsilon(1e-12));
+    }
+
+    uo.setPricingEngine(std::make_shared<engines::BarrierOptionMCEngine>(
+        model, 4000, 12, 1234UL, settings));
+    double uoDedicated = uo.NPV();
+    uo.setPricingEngine(shared);
+    CHECK(uo.NPV() == doctest::Approx(uoDedicated).epsilon(1e-12));
+
+    // Out + In = européenne sur les mêmes chemins
+    ui.setPricingEngine(shared);
+    products::EuropeanOption call1y(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    shared->add(call1y);
+    call1y.setPricingEngine(shared);
+    CHECK(uo.NPV() + ui.NPV() == doctest::Approx(call1y.NPV()).epsilon(1e-12));
+
+    // Maturité intermédiaire : arrêt au pas 6 de la grille
+    call6m.setPricingEngine(shared);
+    auto res = call6m.results();
+    double fwd = 100.0 * std::exp(0.02 * 0.5);
+    double bs  = model->discount(0.5) *
+                 utils::blackForward(fwd, 100.0, 0.2 * std::sqrt(0.5), core::OptionType::Call);
+    CHECK(std::abs(res.npv - bs) < 4.0 * res.stdError);
+
+    products::EuropeanOption offGrid(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 0.3);
+    CHECK_THROWS(shared->add(offGrid));
+    offGrid.setPricingEngine(shared);
+    CHECK_THROWS(offGrid.NPV());
+}
+
+TEST_CASE("SharedPathMCEngine - rebates comme BarrierOptionMCEngine") {
+    auto model = makeModel();
+
+    for (auto monitoring : {engines::BarrierMonitoring::Discrete, engines::BarrierMonitoring::Continuous}) {
+        engines::MonteCarloSettings settings;
+        settings.blockSize = 256;
+        settings.barrierMonitoring = monitoring;
+
+        auto shared = std::make_shared<engines::SharedPathMCEngine>(
+            model, 1.0, 12, 4000, 1234UL, settings);
+        auto dedicated = std::make_shared<engines::BarrierOptionMCEngine>(
+            model, 4000, 12, 1234UL, settings);
+
+        // knock-out au contact, knock-in à maturité ; un knock-out sans
+        // rebate dans le même groupe de surveillance
+        products::BarrierOption uo(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+            1.0, 115.0, products::BarrierType::UpAndOut, 5.0);
+        products::BarrierOption uoBare(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+            1.0, 115.0, products::BarrierType::UpAndOut);
+        products::BarrierOption di(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Put, 100.0),
+            1.0, 85.0, products::BarrierType::DownAndIn, 3.0);
+
+        for (auto* opt : {&uo, &uoBare, &di}) {
+            shared->add(*opt);
+            opt->setPricingEngine(dedicated);
+            double expected = opt->NPV();
+            opt->setPricingEngine(shared);
+            CHECK(opt->NPV() == doctest::Approx(expected).epsilon(1e-12));
+        }
+        CHECK(uo.NPV() > uoBare.NPV());
+    }
+}
+
+TEST_CASE("SharedPathMCEngine - résultats en cache, resimulés si le modèle change") {
+    auto model  = makeModel();
+    auto shared = std::make_shared<engines::SharedPathMCEngine>(model, 1.0, 12, 4000, 1234UL);
+
+    products::AsianOption asian(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+    shared->add(asian);
+    asian.setPricingEngine(shared);
+
+    auto first = asian.results();
+    CHECK(asian.NPV() == first.npv);
+    CHECK(asian.results().elapsedSeconds == first.elapsedSeconds);
+
+    model->setSigma(0.30);
+    auto bumped = asian.results();
+    CHECK(bumped.npv > first.npv);
+
+    model->setSigma(0.20);
+    CHECK(asian.NPV() == doctest::Approx(first.npv).epsilon(1e-12));
+}
+
+TEST_CASE("AsianOptionMCEngine - grecques pathwise = bump sur les mêmes aléas") {
+    auto price = [](double S0, double r, double sigma, bool greeks) {
+        auto model = std::make_shared<models::BlackScholesModel>(
+            std::make_shared<market::YieldCurve>(r),
+            std::make_shared<market::EquityCurve>(S0, 0.0), sigma);
+        products::AsianOption asian(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+        engines::MonteCarloSettings settings;
+        settings.computeGreeks = greeks;
+        asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+            model, 20000, 12, 5UL, settings));
+        return asian.results();
+    };
+
+    auto res = price(100.0, 0.02, 0.2, true);
+    REQUIRE(res.greeks.has_value());
+    CHECK_FALSE(price(100.0, 0.02, 0.2, false).greeks.has_value());
+
+    double h = 1e-3;
+    double delta = (price(100.0 + h, 0.02, 0.2, false).npv - price(100.0 - h, 0.02, 0.2, false).npv) / (2.0 * h);
+    double vega  = (price(100.0, 0.02, 0.2 + h, false).npv - price(100.0, 0.02, 0.2 - h, false).npv) / (2.0 * h);
+    double rho   = (price(100.0, 0.02 + h, 0.2, false).npv - price(100.0, 0.02 - h, 0.2, false).npv) / (2.0 * h);
+
+    CHECK(res.greeks->delta == doctest::Approx(delta).epsilon(1e-3));
+    CHECK(res.greeks->vega  == doctest::Approx(vega).epsilon(1e-3));
+    CHECK(res.greeks->rho   == doctest::Approx(rho).epsilon(1e-3));
+    CHECK(res.greeks->gamma == doctest::Approx(0.0321).epsilon(0.1));
+}
+
+TEST_CASE("BarrierOptionMCEngine - grecques par rapport de vraisemblance") {
+    engines::MonteCarloSettings settings;
+    settings.computeGreeks = true;
+    settings.barrierMonitoring = engines::BarrierMonitoring::Continuous;
+
+    // Références : dérivées de la formule fermée (barrière continue, B=120)
+    products::BarrierOption uo(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0, 120.0, products::BarrierType::UpAndOut);
+    uo.setPricingEngine(std::make_shared<engines::BarrierOptionMCEngine>(
+        makeModel(), 200000, 5, 1UL, settings));
+    auto g = *uo.results().greeks;
+    CHECK(g.delta == doctest::Approx(-0.01453).epsilon(0.1));
+    CHECK(g.gamma == doctest::Approx(-0.00574).epsilon(0.1));
+    CHECK(g.vega  == doctest::Approx(-12.308).epsilon(0.03));
+    CHECK(g.rho   == doctest::Approx(1.5602).epsilon(0.03));
+
+    // Barrière jamais touchée : grecques Black-Scholes du call
+    settings.barrierMonitoring = engines::BarrierMonitoring::Discrete;
+    products::BarrierOption far(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0),
+        1.0, 1e4, products::BarrierType::UpAndOut);
+    far.setPricingEngine(std::make_shared<engines::BarrierOptionMCEngine>(
+        makeModel(), 200000, 4, 2UL, settings));
+    auto v = *far.results().greeks;
+    CHECK(v.delta == doctest::Approx(0.57926).epsilon(0.02));
+    CHECK(v.gamma == doctest::Approx(0.019552).epsilon(0.1));
+    CHECK(v.vega  == doctest::Approx(39.104).epsilon(0.05));
+    CHECK(v.rho   == doctest::Approx(49.010).epsilon(0.02));
+}
+
+TEST_CASE("Philox4x32 - vecteurs de référence Random123") {
+    using C = utils::Philox4x32::Counter;
+
+    CHECK(utils::Philox4x32(utils::Philox4x32::Key{0u, 0u})(C{0u, 0u, 0u, 0u}) ==
+          C{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u});
+    CHECK(utils::Philox4x32(utils::Philox4x32::Key{0xffffffffu, 0xffffffffu})(
+              C{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}) ==
+          C{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu});
+    CHECK(utils::Philox4x32(utils::Philox4x32::Key{0xa4093822u, 0x299f31d0u})(
+              C{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}) ==
+          C{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u});
+
+    // Accès direct et saut en O(1)
+    utils::Philox4x32 philox(42u);
+    std::vector<double> u(7);
+    philox.uniforms(3, 1, u.data(), u.size());
+    for (std::size_t k = 0; k < u.size(); ++k) {
+        CHECK(u[k] == philox.uniform(3, 1 + k));
+        CHECK(u[k] > 0.0);
+        CHECK(u[k] < 1.0);
+    }
+
+    utils::PhiloxEngine seq(42u), skipped(42u);
+    for (int k = 0; k < 13; ++k) seq();
+    skipped.discard(13);
+    CHECK(seq() == skipped());
+}
+
+TEST_CASE("Philox - prix indépendant du découpage en blocs") {
+    products::AsianOption asian(
+        std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+
+    double prices[2];
+    std::size_t sizes[2] = {100, 1024};
+    for (int k = 0; k < 2; ++k) {
+        engines::MonteCarloSettings settings;
+        settings.generator = engines::RandomGenerator::Philox;
+        settings.blockSize = sizes[k];
+        settings.antithetic = true;
+        settings.nThreads = 2;
+        asian.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+            makeModel(), 20000, 12, 9UL, settings));
+        prices[k] = asian.NPV();
+    }
+    // mêmes chemins, seul l'ordre de sommation change
+    CHECK(prices[0] == doctest::Approx(prices[1]).epsilon(1e-12));
+    CHECK(prices[0] == doctest::Approx(5.3786).epsilon(2e-2));
+}
+
+TEST_CASE("ZigguratNormal - moments et queues de N(0,1)") {
+    std::mt19937_64 gen(2024);
+    utils::ZigguratNormal normal;
+
+    const std::size_t n = 1000000;
+    std::vector<double> z(n);
+    normal.fill(gen, z.data(), n);
+
+    double m1 = 0.0, m2 = 0.0, m4 = 0.0;
+    std::size_t below = 0, tail = 0;
+    for (double v : z) {
+        m1 += v;
+        m2 += v * v;
+        m4 += v * v * v * v;
+        below += (v < -1.0);
+        tail  += (std::abs(v) > 3.5);
+    }
+    m1 /= n; m2 /= n; m4 /= n;
+
+    CHECK(std::abs(m1) < 5e-3);
+    CHECK(m2 == doctest::Approx(1.0).epsilon(5e-3));
+    CHECK(m4 == doctest::Approx(3.0).epsilon(2e-2));
+    CHECK(static_cast<double>(below) / n == doctest::Approx(0.158655).epsilon(1e-2));
+    // au-delà de R = 3.44 : branche de queue
+    CHECK(static_cast<double>(tail) / n == doctest::Approx(4.6528e-4).epsilon(0.1));
+
+    // même seed, même suite, tirage unitaire ou en bloc
+    std::mt19937_64 again(2024);
+    for (std::size_t k = 0; k < 100; ++k) {
+        CHECK(normal(again) == z[k]);
+    }
+}
@@ -1,6 +1,12 @@
 #include "doctest/doctest.h"
 
 #include "core/Payoff.hpp"
+#include "core/PayoffKernels.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 using namespace pricer::core;
 
@@ -31,3 +37,76 @@ TEST_CASE("DigitalPayoff Put") {
     CHECK(payoff(99.0)  == doctest::Approx(10.0));
     CHECK(payoff(101.0) == doctest::Approx(0.0));
 }
+
+namespace {
+
+// Payoff hors catalogue : chemin générique (appel virtuel)
+class PowerPayoff : public Payoff {
+public:
+    double operator()(double spot) const override { return spot * spot; }
+};
+
+// Payoff client dérivé d'un payoff standard, operator() redéfini
+class CappedCallPayoff : public PlainVanillaPayoff {
+public:
+    CappedCallPayoff() : PlainVanillaPayoff(OptionType::Call, 100.0) {}
+    double operator()(double spot) const override {
+        return std::min(PlainVanillaPayoff::operator()(spot), 20.0);
+    }
+};
+
+} 
+
+TEST_CASE("Payoff::evaluate = operator() sur un bloc") {
+    std::vector<double> spots{50.0, 99.0, 100.0, 100.5, 101.0, 150.0};
+    std::vector<double> out(spots.size());
+
+    std::unique_ptr<Payoff> payoffs[] = {
+        std::make_unique<PlainVanillaPayoff>(OptionType::Call, 100.0),
+        std::make_unique<PlainVanillaPayoff>(OptionType::Put, 100.0),
+        std::make_unique<DigitalPayoff>(OptionType::Call, 100.0, 10.0),
+        std::make_unique<DigitalPayoff>(OptionType::Put, 100.0, 10.0),
+        std::make_unique<PowerPayoff>(),
+        std::make_unique<CappedCallPayoff>(),
+    };
+    for (const auto& payoff : payoffs) {
+        payoff->evaluate(spots.data(), out.data(), spots.size());
+        for (std::size_t i = 0; i < spots.size(); ++i) {
+            CHECK(out[i] == (*payoff)(spots[i]));
+        }
+    }
+}
+
+TEST_CASE("visitPayoff choisit le noyau compilé") {
+    PlainVanillaPayoff put(OptionType::Put, 100.0);
+    DigitalPayoff call(OptionType::Call, 100.0, 10.0);
+    PowerPayoff power;
+
+    bool vanillaPut = visitPayoff(put, [](const auto& k) {
+        return std::is_same_v<std::decay_t<decltype(k)>, VanillaKernel<OptionType::Put>>;
+    });
+    bool digitalCall = visitPayoff(call, [](const auto& k) {
+        return std::is_same_v<std::decay_t<decltype(k)>, DigitalKernel<OptionType::Call>>;
+    });
+    bool generic = visitPayoff(power, [](const auto& k) {
+        return std::is_same_v<std::decay_t<decltype(k)>, GenericKernel>;
+    });
+    CHECK(vanillaPut);
+    CHECK(digitalCall);
+    CHECK(generic);
+    CHECK(visitPayoff(put, [](const auto& k) { return k(90.0); }) == 10.0);
+
+    CHECK(payoffAs<PlainVanillaPayoff>(put) == &put);
+    CHECK(payoffAs<DigitalPayoff>(put) == nullptr);
+    CHECK(payoffAs<PlainVanillaPayoff>(power) == nullptr);
+
+    // Classe dérivée : vue comme PlainVanillaPayoff, mais noyau générique
+    // pour garder son operator()
+    CappedCallPayoff capped;
+    CHECK(payoffAs<PlainVanillaPayoff>(capped) == &capped);
+    bool cappedGeneric = visitPayoff(capped, [](const auto& k) {
+        return std::is_same_v<std::decay_t<decltype(k)>, GenericKernel>;
+    });
+    CHECK(cappedGeneric);
+    CHECK(visitPayoff(capped, [](const auto& k) { return k(150.0); }) == 20.0);
+}
@@ -0,0 +1,591 @@
+#include "doctest/doctest.h"
+
+#include "market/MarketData.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "models/BlackIRModel.hpp"
+#include "core/EngineFactory.hpp"
+#include "core/InstrumentArena.hpp"
+#include "core/InstrumentFactory.hpp"
+#include "core/Portfolio.hpp"
+#include "core/AsyncPricing.hpp"
+#include "engines/AsianOptionMCEngine.hpp"
+#include "engines/EuropeanOptionBSEngine.hpp"
+#include "engines/SharedPathMCEngine.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace pricer;
+
+namespace {
+
+struct Book {
+    std::shared_ptr<models::BlackScholesModel> bs;
+    std::shared_ptr<models::BlackIRModel> ir;
+    core::Portfolio portfolio;
+};
+
+// Livre mixte : vanilles et digitales en formule fermée, asiatiques et
+// barrières digitales en Monte Carlo, caplets, swaps et swaptions
+Book mixedBook() {
+    using F  = core::InstrumentFactory;
+    using OT = core::OptionType;
+
+    Book b;
+    b.bs = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02),
+        std::make_shared<market::EquityCurve>(100.0, 0.01), 0.2);
+    b.ir = std::make_shared<models::BlackIRModel>(std::make_shared<market::YieldCurve>(0.02), 0.25);
+    core::EngineFactory factory(b.bs, b.ir);
+
+    std::vector<double> times{1.0, 2.0, 3.0, 4.0, 5.0};
+    std::vector<double> accruals(5, 1.0);
+
+    for (int i = 0; i < 40; ++i) {
+        double K = 80.0 + i;
+        OT type  = (i % 2) ? OT::Put : OT::Call;
+        b.portfolio.add(std::make_shared<products::EuropeanOption>(F::makeEuropeanOption(type, K, 1.0)));
+        b.portfolio.add(std::make_shared<products::DigitalOption>(F::makeDigitalOption(type, K, 0.5, 10.0)));
+        b.portfolio.add(std::make_shared<products::Caplet>(F::makeCaplet(1e6, 0.02 + 0.0005 * i, 0.028, 0.5, 1.0, 0.5)));
+        b.portfolio.add(std::make_shared<products::InterestRateSwap>(
+            F::makeSwap(1e6, 0.02 + 0.0005 * i, times, accruals, 0.028, i % 2 == 0)));
+    }
+    for (int i = 0; i < 4; ++i) {
+        auto swap = F::makeSwap(1e6, 0.03, times, accruals, 0.028, true);
+        b.portfolio.add(std::make_shared<products::Swaption>(F::makeSwaption(swap, 1.0)));
+        b.portfolio.add(std::make_shared<products::AsianOption>(
+                            std::make_unique<core::PlainVanillaPayoff>(OT::Call, 95.0 + 5.0 * i), 1.0),
+                        std::make_shared<engines::AsianOptionMCEngine>(b.bs, 2000 * (i + 1), 12, 7UL));
+        b.portfolio.add(std::make_shared<products::BarrierOption>(
+            std::make_unique<core::DigitalPayoff>(OT::Call, 100.0, 10.0), 1.0,
+            130.0, products::BarrierType::UpAndOut));
+    }
+    b.portfolio.assignEngines(factory);
+    return b;
+}
+
+} 
+
+TEST_CASE("Portfolio - prix parallèles = NPV instrument par instrument") {
+    auto book = mixedBook();
+    auto& pf  = book.portfolio;
+    REQUIRE(pf.size() == 172);
+
+    std::vector<double> serial(pf.size());
+    for (std::size_t i = 0; i < pf.size(); ++i) {
+        serial[i] = pf.instrument(i).NPV();
+    }
+
+    utils::ThreadPool pool(4);
+    for (std::size_t chunk : {1u, 7u, 256u}) {
+        auto res = pf.price(pool, chunk);
+        REQUIRE(res.npvs.size() == pf.size());
+        for (std::size_t i = 0; i < pf.size(); ++i) {
+            CHECK(res.npvs[i] == doctest::Approx(serial[i]).epsilon(1e-12));
+        }
+    }
+
+    // Agrégats : sommes dans l'ordre du livre
+    auto res = pf.price(pool);
+    double total = 0.0, equity = 0.0, caplets = 0.0;
+    for (std::size_t i = 0; i < pf.size(); ++i) {
+        total += serial[i];
+        if (std::string(pf.modelName(i)) == "BlackScholes") equity += serial[i];
+        if (std::string(pf.productType(i)) == "Caplet") caplets += serial[i];
+    }
+    CHECK(res.total == doctest::Approx(total));
+    CHECK(res.byModel["BlackScholes"] == doctest::Approx(equity));
+    CHECK(res.byModel["BlackScholes"] + res.byModel["BlackIR"] == doctest::Approx(res.total));
+    CHECK(res.byProduct["Caplet"] == doctest::Approx(caplets));
+    CHECK(res.byProduct.size() == 7);
+
+    CHECK(pf.price().total == doctest::Approx(total));
+}
+
+namespace {
+
+// Compte les instruments passés au moteur en paquet et un par un
+class CountingBatchEngine : public engines::EuropeanOptionBSEngine {
+public:
+    using engines::EuropeanOptionBSEngine::EuropeanOptionBSEngine;
+    mutable std::atomic<int> priced{0};
+    mutable std::atomic<int> single{0};
+
+protected:
+    double priceImpl(const core::Instrument& inst) const override {
+        ++single;
+        return engines::EuropeanOptionBSEngine::priceImpl(inst);
+    }
+
+    void batchImpl(utils::Span<const core::Instrument* const> instruments,
+                   utils::Span<double> out) const override {
+        priced += static_cast<int>(instruments.size());
+        engines::EuropeanOptionBSEngine::batchImpl(instruments, out);
+    }
+};
+
+} 
+
+TEST_CASE("Portfolio - cache NPV des instruments lu et rempli") {
+    auto model = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02),
+        std::make_shared<market::EquityCurve>(100.0, 0.0), 0.2);
+    auto engine = std::make_shared<CountingBatchEngine>(model);
+
+    core::Portfolio pf;
+    std::vector<std::shared_ptr<products::EuropeanOption>> options;
+    for (int i = 0; i < 10; ++i) {
+        options.push_back(std::make_shared<products::EuropeanOption>(
+            core::InstrumentFactory::makeEuropeanOption(core::OptionType::Call, 90.0 + 2.0 * i, 1.0)));
+        pf.add(options.back(), engine);
+    }
+    // Prix déjà en cache : pas recalculé
+    double cached = options[3]->NPV();
+
+    utils::ThreadPool pool(2);
+    auto first = pf.price(pool, 4);
+    CHECK(engine->priced == 9);
+    CHECK(first.npvs[3] == cached);
+    // NPV() lit le cache rempli par les paquets : pas de calcul
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        CHECK(options[i]->NPV() == first.npvs[i]);
+    }
+    CHECK(engine->single == 1);
+
+    // Cache rempli par le premier calcul
+    auto second = pf.price(pool, 4);
+    CHECK(engine->priced == 9);
+    CHECK(second.npvs == first.npvs);
+
+    // Marché modifié : cache vidé, tout est recalculé
+    model->setSigma(0.25);
+    auto moved = pf.price(pool, 4);
+    CHECK(engine->priced == 19);
+    CHECK(moved.total > first.total);
+}
+
+namespace {
+
+// Déplace le spot après son premier paquet : les prix de ce paquet sont
+// calculés sur l'ancien marché
+class TickingBatchEngine : public engines::EuropeanOptionBSEngine {
+public:
+    TickingBatchEngine(std::shared_ptr<models::BlackScholesModel> model,
+                       std::shared_ptr<market::EquityCurve> equity)
+        : engines::EuropeanOptionBSEngine(std::move(model)), equity_(std::move(equity)) {}
+
+protected:
+    void batchImpl(utils::Span<const core::Instrument* const> instruments,
+                   utils::Span<double> out) const override {
+        engines::EuropeanOptionBSEngine::batchImpl(instruments, out);
+        std::call_once(ticked_, [this] { equity_->setSpot(110.0); });
+    }
+
+private:
+    std::shared_ptr<market::EquityCurve> equity_;
+    mutable std::once_flag ticked_;
+};
+
+} 
+
+TEST_CASE("Portfolio - tick de marché pendant price() : pas de prix périmé en cache") {
+    auto equity = std::make_shared<market::EquityCurve>(100.0, 0.0);
+    auto model  = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02), equity, 0.2);
+    auto engine    = std::make_shared<TickingBatchEngine>(model, equity);
+    auto reference = std::make_shared<engines::EuropeanOptionBSEngine>(model);
+
+    core::Portfolio pf;
+    std::vector<std::shared_ptr<products::EuropeanOption>> options;
+    for (int i = 0; i < 8; ++i) {
+        options.push_back(std::make_shared<products::EuropeanOption>(
+            core::InstrumentFactory::makeEuropeanOption(core::OptionType::Call, 90.0 + 3.0 * i, 1.0)));
+        pf.add(options.back(), engine);
+    }
+
+    // Un paquet, tick après son calcul : prix d'avant le tick rendus, pas
+    // gardés
+    utils::ThreadPool pool(2);
+    auto stale = pf.price(pool, 8);
+    auto fresh = pf.price(pool, 8);
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        double expected = reference->calculate(*options[i]);
+        CHECK(stale.npvs[i] < expected);
+        CHECK(fresh.npvs[i] == doctest::Approx(expected).epsilon(1e-14));
+        CHECK(options[i]->NPV() == fresh.npvs[i]);
+    }
+
+    // Ticks continus depuis un autre thread : une fois le marché arrêté, le
+    // cache ne garde que des prix du dernier spot
+    std::atomic<bool> stop{false};
+    std::thread ticker([&] {
+        for (int k = 0; !stop; ++k) {
+            equity->setSpot(100.0 + (k % 20));
+        }
+    });
+    for (int run = 0; run < 50; ++run) {
+        pf.price(pool, 3);
+    }
+    stop = true;
+    ticker.join();
+    auto last = pf.price(pool, 3);
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        double expected = reference->calculate(*options[i]);
+        CHECK(last.npvs[i] == doctest::Approx(expected).epsilon(1e-14));
+        CHECK(options[i]->NPV() == last.npvs[i]);
+    }
+}
+
+namespace {
+
+// Note le thread de chaque calcul à chemins partagés
+class ThreadRecordingSharedEngine : public engines::SharedPathMCEngine {
+public:
+    using engines::SharedPathMCEngine::SharedPathMCEngine;
+    mutable std::mutex mutex;
+    mutable std::set<std::thread::id> threads;
+
+protected:
+    double priceImpl(const core::Instrument& inst) const override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+        return engines::SharedPathMCEngine::priceImpl(inst);
+    }
+};
+
+} 
+
+TEST_CASE("Portfolio - trades d'un moteur à chemins partagés dans une seule tâche") {
+    auto model = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02),
+        std::make_shared<market::EquityCurve>(100.0, 0.0), 0.2);
+    auto shared = std::make_shared<ThreadRecordingSharedEngine>(model, 1.0, 12, 2000, 5UL);
+    CHECK(shared->sharesCalculation());
+    CHECK_FALSE(engines::EuropeanOptionBSEngine(model).sharesCalculation());
+
+    core::Portfolio pf;
+    std::vector<std::shared_ptr<products::AsianOption>> asians;
+    for (int i = 0; i < 6; ++i) {
+        asians.push_back(std::make_shared<products::AsianOption>(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 90.0 + 4.0 * i), 1.0));
+        shared->add(*asians.back());
+        pf.add(asians.back(), shared);
+    }
+
+    utils::ThreadPool pool(4);
+    auto res = pf.price(pool);
+    CHECK(shared->threads.size() == 1);
+    for (std::size_t i = 0; i < asians.size(); ++i) {
+        CHECK(res.npvs[i] == shared->calculate(*asians[i]));
+    }
+}
+
+TEST_CASE("Portfolio - instruments sans moteur et erreurs") {
+    core::Portfolio pf;
+    pf.add(std::make_shared<products::EuropeanOption>(
+        core::InstrumentFactory::makeEuropeanOption(core::OptionType::Call, 100.0, 1.0)));
+    utils::ThreadPool pool(2);
+    CHECK(pf.price(pool).npvs[0] == 0.0);
+    CHECK_THROWS(pf.price(pool, 0));
+    CHECK_THROWS(pf.add(nullptr));
+
+    // instrument absent du moteur à chemins partagés : l'erreur remonte
+    auto model = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02),
+        std::make_shared<market::EquityCurve>(100.0, 0.0), 0.2);
+    pf.add(std::make_shared<products::AsianOption>(
+               std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0),
+           std::make_shared<engines::SharedPathMCEngine>(model, 1.0, 12, 100));
+    CHECK_THROWS(pf.price(pool));
+}
+
+TEST_CASE("ThreadPool - tâches exécutées, exceptions dans le futur") {
+    utils::ThreadPool pool(3);
+    CHECK(pool.size() == 3);
+
+    std::atomic<int> count{0};
+    std::vector<std::future<void>> jobs;
+    for (int i = 0; i < 100; ++i) {
+        jobs.push_back(pool.submit([&count] { ++count; }));
+    }
+    for (auto& j : jobs) j.get();
+    CHECK(count == 100);
+
+    auto failed = pool.submit([] { throw std::runtime_error("échec"); });
+    CHECK_THROWS_AS(failed.get(), std::runtime_error);
+}
+
+TEST_CASE("parallelFor - boucles imbriquées dans les tâches du pool") {
+    utils::ThreadPool pool(4);
+
+    // chaque tâche lance sa boucle : l'appelant participe, pas d'interblocage
+    std::vector<std::vector<int>> hits(8, std::vector<int>(500, 0));
+    std::vector<std::future<void>> jobs;
+    for (std::size_t j = 0; j < hits.size(); ++j) {
+        jobs.push_back(pool.submit([&hits, j] {
+            utils::parallelFor(500, 0, [&](std::size_t i) { ++hits[j][i]; });
+        }));
+    }
+    for (auto& job : jobs) job.get();
+    for (const auto& h : hits) {
+        CHECK(std::count(h.begin(), h.end(), 1) == 500);
+    }
+
+    // les threads inactifs volent les indices d'une boucle lente
+    std::mutex m;
+    std::set<std::thread::id> ids;
+    pool.submit([&] {
+        utils::parallelFor(32, 4, [&](std::size_t) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            std::lock_guard<std::mutex> lock(m);
+            ids.insert(std::this_thread::get_id());
+        });
+    }).get();
+    CHECK(ids.size() > 1);
+
+    auto failed = pool.submit([] {
+        utils::parallelFor(100, 4, [](std::size_t i) {
+            if (i == 37) throw std::runtime_error("échec");
+        });
+    });
+    CHECK_THROWS_AS(failed.get(), std::runtime_error);
+}
+
+TEST_CASE("Portfolio - Monte Carlo découpés sur le pool") {
+    auto model = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02),
+        std::make_shared<market::EquityCurve>(100.0, 0.0), 0.2);
+
+    engines::MonteCarloSettings serial;
+    serial.blockSize = 256;
+    engines::MonteCarloSettings split = serial;
+    split.nThreads = 0;
+
+    core::Portfolio pf;
+    std::vector<double> sequential;
+    for (int i = 0; i < 6; ++i) {
+        auto payoff = [&] { return std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 90.0 + 4.0 * i); };
+        products::AsianOption ref(payoff(), 1.0);
+        ref.setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(model, 5000, 12, 11UL + i, serial));
+        sequential.push_back(ref.NPV());
+
+        pf.add(std::make_shared<products::AsianOption>(payoff(), 1.0),
+               std::make_shared<engines::AsianOptionMCEngine>(model, 5000, 12, 11UL + i, split));
+    }
+
+    utils::ThreadPool pool(4);
+    auto res = pf.price(pool);
+    for (std::size_t i = 0; i < sequential.size(); ++i) {
+        CHECK(res.npvs[i] == doctest::Approx(sequential[i]).epsilon(1e-12));
+    }
+}
+
+TEST_CASE("priceAsync - mêmes résultats que le calcul synchrone") {
+    auto book = mixedBook();
+    utils::ThreadPool pool(3);
+
+    auto inst = std::make_shared<products::EuropeanOption>(
+        core::InstrumentFactory::makeEuropeanOption(core::OptionType::Call, 100.0, 1.0));
+    inst->setPricingEngine(std::make_shared<engines::EuropeanOptionBSEngine>(book.bs));
+    auto single = core::priceAsync(inst, pool);
+    CHECK(single.get().npv == inst->NPV());
+
+    auto bookFuture = core::priceAsync(book.portfolio, pool, 16);
+    auto res = bookFuture.get();
+    CHECK(res.total == book.portfolio.price(pool).total);
+    CHECK_FALSE(bookFuture.cancelRequested());
+}
+
+TEST_CASE("priceAsync - annulation") {
+    auto model = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02),
+        std::make_shared<market::EquityCurve>(100.0, 0.0), 0.2);
+    utils::ThreadPool pool(2);
+
+    SUBCASE("Monte Carlo interrompu entre deux blocs") {
+        engines::MonteCarloSettings settings;
+        settings.nThreads = 0;
+        auto asian = std::make_shared<products::AsianOption>(
+            std::make_unique<core::PlainVanillaPayoff>(core::OptionType::Call, 100.0), 1.0);
+        // calcul complet : plusieurs minutes
+        asian->setPricingEngine(std::make_shared<engines::AsianOptionMCEngine>(
+            model, 200'000'000, 50, 1UL, settings));
+
+        auto future = core::priceAsync(asian, pool);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        future.cancel();
+        CHECK(future.cancelRequested());
+        CHECK_THROWS_AS(future.get(), utils::OperationCancelled);
+    }
+
+    SUBCASE("tâches pas encore démarrées : rien n'est calculé") {
+        // les deux threads du pool sont occupés jusqu'à release
+        std::promise<void> release;
+        std::shared_future<void> gate = release.get_future().share();
+        auto busy1 = pool.submit([gate] { gate.wait(); });
+        auto busy2 = pool.submit([gate] { gate.wait(); });
+
+        auto call = std::make_shared<products::EuropeanOption>(
+            core::InstrumentFactory::makeEuropeanOption(core::OptionType::Call, 100.0, 1.0));
+        call->setPricingEngine(std::make_shared<engines::EuropeanOptionBSEngine>(model));
+        core::Portfolio pf;
+        pf.add(call);
+
+        auto single = core::priceAsync(call, pool);
+        auto whole  = core::priceAsync(pf, pool);
+        single.cancel();
+        whole.cancel();
+        release.set_value();
+
+        CHECK_THROWS_AS(single.get(), utils::OperationCancelled);
+        CHECK_THROWS_AS(whole.get(), utils::OperationCancelled);
+        busy1.get();
+        busy2.get();
+
+        // nouveau calcul sans annulation
+        CHECK(core::priceAsync(call, pool).get().npv == call->NPV());
+    }
+}
+
+namespace {
+
+// Retient son premier paquet jusqu'à l'ouverture de la porte
+class GatedBatchEngine : public engines::EuropeanOptionBSEngine {
+public:
+    GatedBatchEngine(std::shared_ptr<models::BlackScholesModel> model, std::shared_future<void> gate)
+        : engines::EuropeanOptionBSEngine(std::move(model)), gate_(std::move(gate)) {}
+
+    mutable std::promise<void> entered;
+
+protected:
+    void batchImpl(utils::Span<const core::Instrument* const> instruments,
+                   utils::Span<double> out) const override {
+        engines::EuropeanOptionBSEngine::batchImpl(instruments, out);
+        std::call_once(once_, [this] {
+            entered.set_value();
+            gate_.wait();
+        });
+    }
+
+private:
+    std::shared_future<void> gate_;
+    mutable std::once_flag once_;
+};
+
+} 
+
+TEST_CASE("priceAsync - tick, annulation puis nouveau calcul : prix d'après le tick") {
+    auto equity = std::make_shared<market::EquityCurve>(100.0, 0.0);
+    auto model  = std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02), equity, 0.2);
+    std::promise<void> release;
+    auto engine    = std::make_shared<GatedBatchEngine>(model, release.get_future().share());
+    auto reference = std::make_shared<engines::EuropeanOptionBSEngine>(model);
+
+    core::Portfolio pf;
+    std::vector<std::shared_ptr<products::EuropeanOption>> options;
+    for (int i = 0; i < 6; ++i) {
+        options.push_back(std::make_shared<products::EuropeanOption>(
+            core::InstrumentFactory::makeEuropeanOption(core::OptionType::Put, 95.0 + 2.0 * i, 1.0)));
+        pf.add(options.back(), engine);
+    }
+
+    // Paquet calculé sur l'ancien spot, tick et annulation avant la fin
+    utils::ThreadPool pool(2);
+    auto stale = core::priceAsync(pf, pool, 6);
+    engine->entered.get_future().wait();
+    equity->setSpot(90.0);
+    stale.cancel();
+    release.set_value();
+    try {
+        stale.get();
+    } catch (const utils::OperationCancelled&) {
+    }
+
+    auto fresh = core::priceAsync(pf, pool, 6).get();
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        double expected = reference->calculate(*options[i]);
+        CHECK(fresh.npvs[i] == doctest::Approx(expected).epsilon(1e-14));
+        CHECK(options[i]->NPV() == fresh.npvs[i]);
+    }
+}
+
+namespace {
+
+struct Probe {
+    int* destroyed;
+    ~Probe() { ++*destroyed; }
+};
+
+} 
+
+TEST_CASE("InstrumentArena - livre chargé dans l'arène") {
+    using F  = core::InstrumentFactory;
+    using OT = core::OptionType;
+
+    auto book = mixedBook();
+    core::EngineFactory factory(book.bs, book.ir);
+    std::vector<double> times{1.0, 2.0, 3.0};
+    std::vector<double> accruals(3, 1.0);
+
+    core::InstrumentArena arena(4096);
+    core::Portfolio pf;
+    {
+        auto* call    = F::makeEuropeanOption(arena, OT::Call, 100.0, 1.0);
+        auto* digital = F::makeDigitalOption(arena, OT::Put, 95.0, 0.5, 10.0);
+        auto* barrier = F::makeUpAndOutOption(arena, OT::Call, 100.0, 1.0, 130.0);
+        auto* caplet  = F::makeCaplet(arena, 1e6, 0.03, 0.028, 0.5, 1.0, 0.5);
+        auto* swap    = F::makeSwap(arena, 1e6, 0.03, times, accruals, 0.028, true);
+        auto* swpt    = F::makeSwaption(arena, *swap, 1.0);
+        CHECK(arena.objectCount() == 6);
+
+        // échéanciers dans l'arène, copie ordinaire sur le tas
+        CHECK(swap->scheduleResource() == arena.resource());
+        CHECK(swpt->underlying().scheduleResource() == arena.resource());
+        products::InterestRateSwap heapCopy(*swap);
+        CHECK(heapCopy.scheduleResource() == std::pmr::get_default_resource());
+        CHECK(heapCopy.accruals()[2] == swap->accruals()[2]);
+
+        for (core::Instrument* inst : std::initializer_list<core::Instrument*>{call, digital, barrier, caplet, swap, swpt}) {
+            pf.add(core::InstrumentArena::share(inst));
+        }
+        pf.assignEngines(factory);
+
+        // mêmes prix que les objets alloués un par un
+        auto heapCall = F::makeEuropeanOption(OT::Call, 100.0, 1.0);
+        heapCall.setPricingEngine(factory.createEngine(heapCall));
+        CHECK(call->NPV() == heapCall.NPV());
+        auto heapSwpt = F::makeSwaption(F::makeSwap(1e6, 0.03, times, accruals, 0.028, true), 1.0);
+        heapSwpt.setPricingEngine(factory.createEngine(heapSwpt));
+        CHECK(swpt->NPV() == heapSwpt.NPV());
+    }
+    auto res = pf.price(utils::defaultThreadPool());
+    CHECK(res.byProduct.size() == 6);
+    pf = core::Portfolio{};
+
+    // release() détruit tous les objets, dans l'ordre inverse
+    int destroyed = 0;
+    arena.create<Probe>(Probe{&destroyed});
+    arena.create<Probe>(Probe{&destroyed});
+    destroyed = 0;
+    arena.release();
+    CHECK(destroyed == 2);
+    CHECK(arena.objectCount() == 0);
+
+    // l'arène se réutilise après release()
+    CHECK(F::makeEuropeanOption(arena, OT::Put, 90.0, 2.0)->maturity() == 2.0);
+}
@@ -7,6 +7,11 @@
 #include "products/Swap.hpp"
 #include "engines/SwapEngines.hpp"
 
+#include <cmath>
+#include <tuple>
+#include <memory_resource>
+#include <vector>
+
 using namespace pricer;
 
 TEST_CASE("CapletBlackEngine - simple caplet") {
@@ -78,6 +83,32 @@ TEST_CASE("SwapEngine - 5Y payer swap") {
     CHECK(pv == doctest::Approx(-9421.41).epsilon(1e-2));
 }
 
+TEST_CASE("InterestRateSwap - échéancier sur la ressource voulue") {
+    // listes entre accolades acceptées directement
+    products::InterestRateSwap braced(1e6, 0.03, {1.0, 2.0}, {1.0, 1.0}, 0.028, true);
+    CHECK(braced.paymentTimes().size() == 2);
+    CHECK(braced.accruals()[1] == 1.0);
+    CHECK(braced.scheduleResource() == std::pmr::get_default_resource());
+
+    // copie directe depuis des tableaux dans une ressource donnée
+    double times[] = {1.0, 2.0, 3.0};
+    double accruals[] = {1.0, 1.0, 0.5};
+    std::pmr::monotonic_buffer_resource pool;
+    products::InterestRateSwap pooled(1e6, 0.03, times, accruals, 0.028, true, &pool);
+    CHECK(pooled.scheduleResource() == &pool);
+    CHECK(pooled.paymentTimes() == std::pmr::vector<double>{1.0, 2.0, 3.0});
+    CHECK(pooled.accruals()[2] == 0.5);
+
+    // copie simple sur la ressource par défaut, déplacement sans copie
+    products::InterestRateSwap copy(pooled);
+    CHECK(copy.scheduleResource() == std::pmr::get_default_resource());
+    CHECK(copy.paymentTimes() == pooled.paymentTimes());
+    const double* data = pooled.paymentTimes().data();
+    products::InterestRateSwap moved(std::move(pooled));
+    CHECK(moved.paymentTimes().data() == data);
+    CHECK(moved.scheduleResource() == &pool);
+}
+
 TEST_CASE("SwaptionBlackEngine - payer swaption") {
     double r        = 0.02;
     double sigmaIR  = 0.25;
@@ -114,3 +145,148 @@ TEST_CASE("SwaptionBlackEngine - payer swaption") {
     // Valeur de référence ~ 9390.13
     CHECK(price == doctest::Approx(9390.13).epsilon(1e-2));
 }
+
+TEST_CASE("Volatilité implicite - caplet et swaption") {
+    auto modelIR = std::make_shared<models::BlackIRModel>(
+        std::make_shared<market::YieldCurve>(0.02), 0.25
+    );
+
+    products::Caplet caplet(1'000'000.0, 0.03, 0.028, 0.5, 1.0, 0.5, core::OptionType::Call);
+    engines::CapletBlackEngine capletEngine(modelIR);
+    caplet.setPricingEngine(std::make_shared<engines::CapletBlackEngine>(modelIR));
+    CHECK(capletEngine.impliedVolatility(caplet, caplet.NPV()) == doctest::Approx(0.25).epsilon(1e-12));
+
+    std::vector<double> times   = {1.0, 2.0, 3.0, 4.0, 5.0};
+    std::vector<double> accrual = {1.0, 1.0, 1.0, 1.0, 1.0};
+    for (bool payer : {true, false}) {
+        products::InterestRateSwap swap(1'000'000.0, 0.03, times, accrual, 0.028, payer);
+        products::Swaption swaption(swap, 1.0);
+        engines::SwaptionBlackEngine engine(modelIR);
+        swaption.setPricingEngine(std::make_shared<engines::SwaptionBlackEngine>(modelIR));
+        CHECK(engine.impliedVolatility(swaption, swaption.NPV()) == doctest::Approx(0.25).epsilon(1e-12));
+        CHECK_THROWS(engine.impliedVolatility(swaption, -1.0));
+    }
+}
+
+TEST_CASE("Caplet et swaption - grecques analytiques") {
+    // Re-pricing complet : courbe, vol, forward et calendrier choqués
+    struct Inputs { double r, vol, F, shift; };
+    auto capletResults = [](const Inputs& in, core::OptionType type) {
+        auto model = std::make_shared<models::BlackIRModel>(
+            std::make_shared<market::YieldCurve>(in.r), in.vol);
+        products::Caplet caplet(1'000'000.0, 0.03, in.F, 0.5 - in.shift, 1.0 - in.shift, 0.5, type);
+        caplet.setPricingEngine(std::make_shared<engines::CapletBlackEngine>(model));
+        return caplet.results();
+    };
+    auto swaptionResults = [](const Inputs& in, core::OptionType type) {
+        auto model = std::make_shared<models::BlackIRModel>(
+            std::make_shared<market::YieldCurve>(in.r), in.vol);
+        std::vector<double> times;
+        for (double t : {2.0, 3.0, 4.0, 5.0, 6.0}) times.push_back(t - in.shift);
+        std::vector<double> accrual(times.size(), 1.0);
+        products::InterestRateSwap swap(1'000'000.0, 0.03, times, accrual, in.F,
+                                        type == core::OptionType::Call);
+        products::Swaption swaption(swap, 1.0 - in.shift);
+        swaption.setPricingEngine(std::make_shared<engines::SwaptionBlackEngine>(model));
+        return swaption.results();
+    };
+
+    for (auto type : {core::OptionType::Call, core::OptionType::Put}) {
+        for (int product = 0; product < 2; ++product) {
+            auto price = [&](const Inputs& in) {
+                return product == 0 ? capletResults(in, type) : swaptionResults(in, type);
+            };
+            Inputs in{0.02, 0.25, 0.028, 0.0};
+            auto res = price(in);
+            REQUIRE(res.greeks);
+            const auto& g = *res.greeks;
+
+            auto diff = [&](double Inputs::*field, double h) {
+                Inputs up = in, down = in;
+                up.*field += h;
+                down.*field -= h;
+                double vUp = price(up).npv, vDown = price(down).npv;
+                return std::make_tuple((vUp - vDown) / (2.0 * h),
+                                       (vUp - 2.0 * res.npv + vDown) / (h * h));
+            };
+
+            auto [dF, d2F] = diff(&Inputs::F, 1e-5);
+            CHECK(g.delta == doctest::Approx(dF).epsilon(1e-6));
+            CHECK(g.gamma == doctest::Approx(d2F).epsilon(1e-4));
+            CHECK(g.vega  == doctest::Approx(std::get<0>(diff(&Inputs::vol, 1e-5))).epsilon(1e-6));
+            CHECK(g.rho   == doctest::Approx(std::get<0>(diff(&Inputs::r, 1e-5))).epsilon(1e-6));
+            CHECK(g.theta == doctest::Approx(std::get<0>(diff(&Inputs::shift, 1e-5))).epsilon(1e-6));
+            // prix linéaire en l'annuité : V = A dV/dA
+            double A = 0.0;
+            if (product == 0) A = 0.5 * std::exp(-0.02);
+            else for (double t : {2.0, 3.0, 4.0, 5.0, 6.0}) A += std::exp(-0.02 * t);
+            CHECK(g.annuity * A == doctest::Approx(res.npv).epsilon(1e-13));
+        }
+    }
+}
+
+TEST_CASE("calculateBatch - moteurs de taux") {
+    auto modelIR = std::make_shared<models::BlackIRModel>(
+        std::make_shared<market::YieldCurve>(0.02), 0.25
+    );
+
+    std::vector<products::Caplet> caplets;
+    std::vector<products::Floorlet> floorlets;
+    for (int i = 0; i < 8; ++i) {
+        double start = 0.25 + 0.5 * i;
+        caplets.emplace_back(1e6, 0.025 + 0.001 * i, 0.028, start, start + 0.5, 0.5);
+        floorlets.emplace_back(1e6, 0.025 + 0.001 * i, 0.028, start, start + 0.5, 0.5);
+    }
+    products::Cap cap1(caplets), cap2(std::vector<products::Caplet>(caplets.begin(), caplets.begin() + 3));
+    products::Floor floor1(floorlets), floor2(std::vector<products::Floorlet>(floorlets.begin() + 2, floorlets.end()));
+
+    std::vector<double> times{1.0, 2.0, 3.0, 4.0, 5.0}, accrual(5, 1.0);
+    products::InterestRateSwap payer(1e6, 0.03, times, accrual, 0.028, true);
+    products::InterestRateSwap receiver(2e6, 0.025, times, accrual, 0.028, false);
+    products::Swaption swpt1(payer, 1.0), swpt2(receiver, 0.5), expired(payer, 0.0);
+
+    auto check = [](const core::PricingEngine& engine, std::vector<const core::Instrument*> insts) {
+        std::vector<double> out(insts.size());
+        engine.calculateBatch(insts, out);
+        for (std::size_t i = 0; i < insts.size(); ++i) {
+            CHECK(out[i] == doctest::Approx(engine.calculate(*insts[i])).epsilon(1e-13));
+        }
+    };
+
+    check(engines::CapletBlackEngine(modelIR), {&caplets[0], &caplets[5], &floorlets[3]});
+    check(engines::CapBlackEngine(modelIR), {&cap1, &cap2, &cap1});
+    check(engines::FloorBlackEngine(modelIR), {&floor1, &floor2});
+    check(engines::SwapEngine(modelIR), {&payer, &receiver});
+    check(engines::SwaptionBlackEngine(modelIR), {&swpt1, &expired, &swpt2});
+
+    std::vector<const core::Instrument*> wrong{&cap1};
+    std::vector<double> out(1);
+    CHECK_THROWS(engines::SwapEngine(modelIR).calculateBatch(wrong, out));
+}
+
+TEST_CASE("Instrument - cache de taux et copies") {
+    auto curve = std::make_shared<market::YieldCurve>(0.02);
+    auto model = std::make_shared<models::BlackIRModel>(curve, 0.25);
+
+    products::Caplet caplet(1e6, 0.03, 0.028, 0.5, 1.0, 0.5);
+    caplet.setPricingEngine(std::make_shared<engines::CapletBlackEngine>(model));
+    double p0 = caplet.NPV();
+
+    // la copie s'enregistre auprès du même moteur
+    products::Caplet copy(caplet);
+    std::vector<products::Caplet> book(3, caplet);
+    CHECK(copy.NPV() == p0);
+
+    model->setSigma(0.35);
+    CHECK(caplet.NPV() > p0);
+    CHECK(copy.NPV() == caplet.NPV());
+    CHECK(book.back().NPV() == caplet.NPV());
+
+    curve->setRate(0.04);
+    double p1 = caplet.NPV();
+    products::Caplet fresh(1e6, 0.03, 0.028, 0.5, 1.0, 0.5);
+    fresh.setPricingEngine(std::make_shared<engines::CapletBlackEngine>(
+        std::make_shared<models::BlackIRModel>(std::make_shared<market::YieldCurve>(0.04), 0.35)));
+    CHECK(p1 == doctest::Approx(fresh.NPV()));
+    CHECK(copy.NPV() == p1);
+}
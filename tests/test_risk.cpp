@@ -0,0 +1,250 @@
+#include "doctest/doctest.h"
+
+#include "market/MarketData.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "models/BlackIRModel.hpp"
+#include "core/EngineFactory.hpp"
+#include "core/InstrumentFactory.hpp"
+#include "core/Portfolio.hpp"
+#include "engines/BarrierOptionMCEngine.hpp"
+#include "engines/SharedPathMCEngine.hpp"
+#include "products/VanillaBook.hpp"
+#include "risk/Scenario.hpp"
+#include "risk/ScenarioEngine.hpp"
+#include "utils/Cancellation.hpp"
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace pricer;
+
+namespace {
+
+std::shared_ptr<models::BlackScholesModel> equityModel(double spot, double q, double sigma) {
+    return std::make_shared<models::BlackScholesModel>(
+        std::make_shared<market::YieldCurve>(0.02),
+        std::make_shared<market::EquityCurve>(spot, q), sigma);
+}
+
+// Ancienne méthode : courbes, modèles et moteurs reconstruits pour le
+// scénario, puis NPV() trade par trade
+double repriceNaive(const std::vector<std::shared_ptr<core::Instrument>>& trades,
+                    const std::vector<std::uint32_t>& underlyings,
+                    const std::vector<std::shared_ptr<models::BlackScholesModel>>& base,
+                    const models::BlackIRModel& ir,
+                    const risk::ScenarioSet& set, std::size_t s)
+{
+    auto irShocked = std::make_shared<models::BlackIRModel>(
+        std::make_shared<market::YieldCurve>(ir.rate() + set.rates(s).rate), ir.sigma() + set.rates(s).vol);
+    double total = 0.0;
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        const auto& m = *base[underlyings[i]];
+        const auto& shift = set.equity(s, underlyings[i]);
+        auto bs = std::make_shared<models::BlackScholesModel>(
+            std::make_shared<market::YieldCurve>(m.rate() + set.rates(s).rate),
+            std::make_shared<market::EquityCurve>(m.spot() * (1.0 + shift.spot), m.dividendYield() + shift.dividend),
+            m.sigma() + shift.vol);
+        core::EngineFactory factory(bs, irShocked);
+        trades[i]->setPricingEngine(factory.createEngine(*trades[i]));
+        total += trades[i]->NPV();
+    }
+    return total;
+}
+
+} 
+
+TEST_CASE("ScenarioEngine - P&L = revalorisation complète par scénario") {
+    using F  = core::InstrumentFactory;
+    using OT = core::OptionType;
+
+    std::vector<std::shared_ptr<models::BlackScholesModel>> equities{
+        equityModel(100.0, 0.01, 0.2), equityModel(50.0, 0.03, 0.35)};
+    auto ir = std::make_shared<models::BlackIRModel>(std::make_shared<market::YieldCurve>(0.025), 0.3);
+
+    std::vector<std::shared_ptr<core::Instrument>> trades;
+    std::vector<std::uint32_t> underlyings;
+    auto push = [&](std::shared_ptr<core::Instrument> inst, std::uint32_t u) {
+        trades.push_back(std::move(inst));
+        underlyings.push_back(u);
+    };
+    std::vector<double> times{1.0, 2.0, 3.0};
+    std::vector<double> accruals(3, 1.0);
+    for (int i = 0; i < 30; ++i) {
+        std::uint32_t u = i % 2;
+        double S = equities[u]->spot();
+        OT type = (i % 3) ? OT::Put : OT::Call;
+        push(std::make_shared<products::EuropeanOption>(F::makeEuropeanOption(type, S * (0.8 + 0.015 * i), 0.25 + 0.1 * i)), u);
+        push(std::make_shared<products::DigitalOption>(F::makeDigitalOption(type, S * (0.9 + 0.01 * i), 0.5, 5.0)), u);
+    }
+    push(std::make_shared<products::EuropeanOption>(F::makeEuropeanOption(OT::Call, 90.0, 0.0)), 0);  // échue
+    push(std::make_shared<products::BarrierOption>(F::makeUpAndOutOption(OT::Call, 100.0, 1.0, 130.0)), 0);
+    push(std::make_shared<products::BarrierOption>(F::makeUpAndOutOption(OT::Call, 50.0, 1.0, 65.0)), 1);
+    push(std::make_shared<products::Caplet>(F::makeCaplet(1e6, 0.03, 0.028, 0.5, 1.0, 0.5)), 0);
+    push(std::make_shared<products::InterestRateSwap>(F::makeSwap(1e6, 0.03, times, accruals, 0.028, true)), 0);
+    push(std::make_shared<products::Swaption>(
+        F::makeSwaption(F::makeSwap(1e6, 0.03, times, accruals, 0.028, true), 1.0)), 0);
+
+    risk::ScenarioEngine engine(equities, ir);
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        engine.add(trades[i], underlyings[i]);
+    }
+    CHECK(engine.size() == trades.size());
+
+    std::vector<std::vector<risk::EquityShift>> equityShifts{
+        {{}, {}},  // choc nul
+        {{-0.1, 0.05, 0.0}, {0.05, -0.1, 0.01}},
+        {{0.2, -0.05, 0.005}, {-0.3, 0.1, 0.0}},
+        {{0.0, 0.0, -0.01}, {0.0, 0.0, 0.0}}};
+    std::vector<risk::RateShift> rateShifts{{}, {0.01, 0.0}, {-0.005, 0.05}, {0.0, -0.1}};
+    risk::ScenarioSet set(2);
+    for (std::size_t s = 0; s < rateShifts.size(); ++s) {
+        set.add(rateShifts[s], equityShifts[s]);
+    }
+
+    auto res = engine.run(set);
+    REQUIRE(res.values.size() == set.size());
+    CHECK(res.pnl[0] == 0.0);
+
+    risk::ScenarioSet none(2);
+    none.add(risk::RateShift{}, equityShifts[0]);
+    double base = repriceNaive(trades, underlyings, equities, *ir, none, 0);
+    CHECK(res.baseValue == doctest::Approx(base).epsilon(1e-12));
+
+    for (std::size_t s = 0; s < set.size(); ++s) {
+        double expected = repriceNaive(trades, underlyings, equities, *ir, set, s);
+        CHECK(res.values[s] == doctest::Approx(expected).epsilon(1e-12));
+        CHECK(res.pnl[s] == doctest::Approx(expected - base).epsilon(1e-9).scale(1e3));
+    }
+
+    // Marché de base relu à chaque appel
+    equities[0]->setSigma(0.25);
+    auto moved = engine.run(set);
+    CHECK(moved.baseValue > res.baseValue);
+    CHECK(moved.pnl[0] == 0.0);
+}
+
+namespace {
+
+// Moteur sans clone : pas de revalorisation sur un marché choqué
+class FixedPriceEngine : public core::PricingEngine {
+protected:
+    double priceImpl(const core::Instrument&) const override { return 1.0; }
+};
+
+} 
+
+TEST_CASE("ScenarioEngine - moteur propre des instruments hors VanillaBook") {
+    using F  = core::InstrumentFactory;
+    using OT = core::OptionType;
+
+    auto equity = equityModel(100.0, 0.01, 0.25);
+    auto ir = std::make_shared<models::BlackIRModel>(std::make_shared<market::YieldCurve>(0.02), 0.2);
+
+    // Barrière en Monte Carlo (la fabrique prendrait la formule fermée),
+    // asiatique sur chemins partagés
+    auto barrier = std::make_shared<products::BarrierOption>(F::makeUpAndOutOption(OT::Call, 100.0, 1.0, 130.0));
+    barrier->setPricingEngine(std::make_shared<engines::BarrierOptionMCEngine>(equity, 3000, 50, 11UL));
+    auto asian = std::make_shared<products::AsianOption>(
+        std::make_unique<core::PlainVanillaPayoff>(OT::Call, 100.0), 1.0);
+    auto shared = std::make_shared<engines::SharedPathMCEngine>(equity, 1.0, 12, 3000, 13UL);
+    shared->add(*asian);
+    asian->setPricingEngine(shared);
+
+    risk::ScenarioEngine engine(equity, ir);
+    engine.add(barrier);
+    engine.add(asian);
+
+    risk::ScenarioSet set;
+    set.add(risk::RateShift{0.01, 0.0}, risk::EquityShift{-0.1, 0.05, 0.0});
+    set.add(risk::RateShift{}, risk::EquityShift{0.15, -0.05, 0.01});
+    auto res = engine.run(set);
+
+    // Mêmes moteurs, mêmes graines, reconstruits à la main sur le marché choqué
+    for (std::size_t s = 0; s < set.size(); ++s) {
+        const auto& shift = set.equity(s, 0);
+        auto bs = std::make_shared<models::BlackScholesModel>(
+            std::make_shared<market::YieldCurve>(equity->rate() + set.rates(s).rate),
+            std::make_shared<market::EquityCurve>(equity->spot() * (1.0 + shift.spot),
+                                                  equity->dividendYield() + shift.dividend),
+            equity->sigma() + shift.vol);
+        engines::BarrierOptionMCEngine barrierMC(bs, 3000, 50, 11UL);
+        engines::SharedPathMCEngine paths(bs, 1.0, 12, 3000, 13UL);
+        paths.add(*asian);
+        double expected = barrierMC.calculate(*barrier) + paths.calculate(*asian);
+        CHECK(res.values[s] == doctest::Approx(expected).epsilon(1e-12));
+    }
+    CHECK(res.baseValue == doctest::Approx(barrier->NPV() + asian->NPV()).epsilon(1e-12));
+
+    // Moteur qui ne se recopie pas : refusé à l'ajout
+    auto fixed = std::make_shared<products::BarrierOption>(F::makeUpAndOutOption(OT::Put, 100.0, 1.0, 130.0));
+    fixed->setPricingEngine(std::make_shared<FixedPriceEngine>());
+    CHECK_THROWS_AS(engine.add(fixed), std::runtime_error);
+    CHECK(engine.size() == 2);
+}
+
+TEST_CASE("ScenarioEngine - tuiles indépendantes du nombre de threads") {
+    using OT = core::OptionType;
+
+    products::VanillaBook book;
+    for (int i = 0; i < 9000; ++i) {
+        OT type = (i % 2) ? OT::Put : OT::Call;
+        double K = 60.0 + (i % 80);
+        double T = 0.1 + 0.001 * (i % 1000);
+        if (i % 5 == 0) {
+            book.addDigital(type, K, T, 2.0);
+        } else {
+            book.addEuropean(type, K, T);
+        }
+    }
+    auto ir = std::make_shared<models::BlackIRModel>(std::make_shared<market::YieldCurve>(0.02), 0.2);
+    risk::ScenarioEngine engine(equityModel(100.0, 0.01, 0.2), ir);
+    engine.add(book);
+
+    risk::ScenarioSet set;
+    for (int s = 0; s < 70; ++s) {
+        set.add(risk::RateShift{0.0001 * (s - 35), 0.0}, risk::EquityShift{0.004 * (s - 35), 0.001 * (s % 7), 0.0});
+    }
+
+    auto serial   = engine.run(set, 1);
+    auto parallel = engine.run(set, 4);
+    CHECK(serial.baseValue == parallel.baseValue);
+    CHECK(serial.pnl == parallel.pnl);
+    // les chocs de spot déplacent bien la valeur du livre
+    CHECK(serial.pnl[36] != serial.pnl[34]);
+
+    // Annulation : aucune tuile ne démarre
+    utils::CancellationToken token;
+    token.cancel();
+    utils::CancellationScope scope(&token);
+    CHECK_THROWS_AS(engine.run(set, 1), utils::OperationCancelled);
+}
+
+TEST_CASE("ScenarioEngine - VaR et validation des entrées") {
+    std::vector<double> pnl;
+    for (int i = 1; i <= 500; ++i) {
+        pnl.push_back(static_cast<double>(i) - 250.0);  // pire perte : -249
+    }
+    // 5e pire P&L à 99 %, 25e à 95 %
+    CHECK(risk::valueAtRisk(pnl, 0.99) == 245.0);
+    CHECK(risk::valueAtRisk(pnl, 0.95) == 225.0);
+    CHECK_THROWS_AS(risk::valueAtRisk(pnl, 1.0), std::runtime_error);
+    CHECK_THROWS_AS(risk::valueAtRisk({}, 0.99), std::runtime_error);
+
+    risk::ScenarioSet set(2);
+    CHECK_THROWS_AS(set.add(risk::RateShift{}, risk::EquityShift{}), std::runtime_error);
+    std::vector<risk::EquityShift> wiped{{-1.0, 0.0, 0.0}, {}};
+    CHECK_THROWS_AS(set.add(risk::RateShift{}, wiped), std::runtime_error);
+
+    auto ir = std::make_shared<models::BlackIRModel>(std::make_shared<market::YieldCurve>(0.02), 0.2);
+    risk::ScenarioEngine engine(equityModel(100.0, 0.0, 0.2), ir);
+    CHECK_THROWS_AS(engine.add(std::make_shared<products::EuropeanOption>(
+                        core::InstrumentFactory::makeEuropeanOption(core::OptionType::Call, 100.0, 1.0)), 1),
+                    std::runtime_error);
+    CHECK_THROWS_AS(engine.run(set), std::runtime_error);  // 2 sous-jacents pour 1
+
+    risk::ScenarioSet negativeVol;
+    negativeVol.add(risk::RateShift{}, risk::EquityShift{0.0, -0.3, 0.0});
+    CHECK_THROWS_AS(engine.run(negativeVol), std::runtime_error);
+}
@@ -0,0 +1,86 @@
+#include "doctest/doctest.h"
+
+#include "utils/VectorMath.hpp"
+#include "utils/BlackFormula.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace pricer;
+
+namespace {
+
+const utils::SimdLevel kLevels[] = {
+    utils::SimdLevel::Scalar, utils::SimdLevel::AVX2, utils::SimdLevel::AVX512
+};
+
+} 
+
+TEST_CASE("vexp / vlog conformes à std::exp / std::log") {
+    std::vector<double> x;
+    for (int i = -700; i <= 700; ++i) x.push_back(0.37 * i + 1e-3);
+    std::vector<double> pos;
+    for (int i = 1; i <= 1000; ++i) pos.push_back(std::pow(1.07, i - 500));
+
+    for (auto level : kLevels) {
+        CAPTURE(utils::simdLevelName(level));
+
+        std::vector<double> y(x.size());
+        utils::vexp(x.data(), y.data(), x.size(), level);
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            CHECK(y[i] == doctest::Approx(std::exp(x[i])).epsilon(1e-14));
+        }
+
+        std::vector<double> l(pos.size());
+        utils::vlog(pos.data(), l.data(), pos.size(), level);
+        for (std::size_t i = 0; i < pos.size(); ++i) {
+            CHECK(l[i] == doctest::Approx(std::log(pos[i])).epsilon(1e-14));
+        }
+    }
+}
+
+TEST_CASE("vinverseNormalCdf proche de inverseNormalCdf") {
+    std::vector<double> u;
+    for (int i = 1; i < 2000; ++i) u.push_back(i / 2000.0);
+    u.push_back(1e-10);
+    u.push_back(1.0 - 1e-10);
+
+    for (auto level : kLevels) {
+        CAPTURE(utils::simdLevelName(level));
+
+        std::vector<double> z(u.size());
+        utils::vinverseNormalCdf(u.data(), z.data(), u.size(), level);
+        for (std::size_t i = 0; i < u.size(); ++i) {
+            CHECK(z[i] == doctest::Approx(utils::inverseNormalCdf(u[i])).epsilon(2e-9));
+        }
+    }
+}
+
+TEST_CASE("vnormalCdf conforme à normalCdf, queues comprises") {
+    std::vector<double> x;
+    for (int i = 0; i <= 4000; ++i) x.push_back(-37.0 + i * 0.011);
+    x.push_back(0.0);
+    x.push_back(-40.0);
+
+    for (auto level : kLevels) {
+        CAPTURE(utils::simdLevelName(level));
+
+        std::vector<double> y(x.size());
+        utils::vnormalCdf(x.data(), y.data(), x.size(), level);
+        for (std::size_t i = 0; i + 1 < x.size(); ++i) {
+            CHECK(y[i] == doctest::Approx(utils::normalCdf(x[i])).epsilon(1e-14).scale(0.0));
+        }
+        CHECK(y.back() == 0.0);
+    }
+}
+
+TEST_CASE("erfcx = exp(x^2) erfc(x)") {
+    for (double x : {-3.0, -0.5, 0.0, 0.3, 1.0, 4.0, 10.0, 25.0}) {
+        CAPTURE(x);
+        CHECK(utils::erfcx(x) == doctest::Approx(std::exp(x * x) * std::erfc(x)).epsilon(1e-13));
+    }
+    // asymptotique 1 / (x sqrt(pi)) au-delà du domaine d'erfc
+    constexpr double kSqrtPi = 1.77245385090551602730;
+    double x = 1e4;
+    CHECK(utils::erfcx(x) == doctest::Approx(1.0 / (x * kSqrtPi)).epsilon(1e-8));
+}